@@ -0,0 +1,89 @@
+# Generates translation units holding a large CTCLP configuration and builds them
+# with a compiler launcher that records wall time and peak memory per compile.
+#
+# Each configuration is compiled in stages, so the cost of a stage is the difference
+# to the previous one:
+#   options  building the configuration with options::add
+#   index    the perfect hash over the option names
+#   tables   the value tries and converted value tables
+#   parse    the complete runtime parser
+#   instance the translation unit holding CTCLP_INSTANTIATE_PARSER
+#   extern   a translation unit that uses a parser declared with CTCLP_EXTERN_PARSER, linked 
+#            against the instance stage
+
+find_program(CTCLP_TIME_EXECUTABLE NAMES time PATHS /usr/bin /bin NO_DEFAULT_PATH)
+
+option(CTCLP_COMPILE_TIME_REPORT "Emit -ftime-trace (Clang) or -ftime-report (GCC) for compile benchmarks" OFF)
+
+function(ctclp_add_compile_benchmark_stage target stage label source)
+  set(source_file ${CMAKE_CURRENT_BINARY_DIR}/${target}.cpp)
+  file(CONFIGURE OUTPUT ${source_file} CONTENT "${source}" @ONLY)
+
+  if (stage STREQUAL "instance")
+    add_library(${target} OBJECT ${source_file})
+  else()
+    add_executable(${target} ${source_file})
+  endif()
+  target_link_libraries(${target} PRIVATE ctclp)
+
+  if (CTCLP_COMPILE_TIME_REPORT)
+    target_compile_options(${target} PRIVATE
+      $<$<CXX_COMPILER_ID:Clang>:-ftime-trace> $<$<CXX_COMPILER_ID:GNU>:-ftime-report>)
+  endif()
+
+  set(compiler "${CMAKE_CXX_COMPILER_ID}-${CMAKE_CXX_COMPILER_VERSION}")
+  set(results ${CMAKE_BINARY_DIR}/compile_benchmarks.txt)
+  if (CTCLP_TIME_EXECUTABLE)
+    set_property(TARGET ${target} PROPERTY CXX_COMPILER_LAUNCHER
+      ${CTCLP_TIME_EXECUTABLE} -a -o ${results}
+      -f "${target} ${compiler} ${label} %e s %M KB")
+  else()
+    message(STATUS "GNU time not found: ${target} records wall time only")
+    set_property(TARGET ${target} PROPERTY CXX_COMPILER_LAUNCHER ${CMAKE_COMMAND} -E time)
+  endif()
+endfunction()
+
+function(ctclp_add_compile_benchmark target option_count value_count)
+  math(EXPR last_value "${value_count} - 1")
+  set(values "")
+  foreach(value RANGE ${last_value})
+    list(APPEND values "\"${value}\"")
+  endforeach()
+  list(JOIN values ", " values)
+
+  math(EXPR last_option "${option_count} - 1")
+  set(config "#include <ctclp.hpp>\n\nstatic constexpr auto opts = ctclp::options<${option_count}>{}")
+  foreach(option RANGE ${last_option})
+    string(APPEND config "\n  .add<\"option_${option}\", ctclp::option::integral, "
+                         "ctclp::values<${values}>, ctclp::default_value<\"0\">>()")
+  endforeach()
+  string(APPEND config ";\n\n")
+
+  set(stages options index tables parse instance extern)
+  set(options_main "  return static_cast<int>(opts.size) - argc;\n")
+  set(index_main "  return static_cast<int>(ctclp::parser<opts>::name_index.find(argv[argc - 1]));\n")
+  string(CONCAT tables_main
+    "  using parser = ctclp::parser<opts>;\n"
+    "  return static_cast<int>(std::get<0>(parser::value_tries).find(argv[argc - 1]).value_or(0))\n"
+    "       + static_cast<int>(std::get<${last_option}>(parser::value_tables)[0]);\n")
+  set(parse_main "  return ctclp::parser<opts>::try_parse(argc, argv) ? 0 : 1;\n")
+  set(extern_main "  return ctclp::try_parse<opts>(argc, argv) ? 0 : 1;\n")
+
+  foreach(stage IN LISTS stages)
+    set(source "${config}")
+    if (stage STREQUAL "instance" OR stage STREQUAL "extern")
+      string(APPEND source "CTCLP_EXTERN_PARSER(opts);\n\n")
+    endif()
+    if (stage STREQUAL "instance")
+      string(APPEND source "CTCLP_INSTANTIATE_PARSER(opts);\n")
+    else()
+      string(APPEND source "auto main(int argc, char** argv) -> int {\n" "${${stage}_main}" "}\n")
+    endif()
+    ctclp_add_compile_benchmark_stage(${target}_${stage} ${stage} "${option_count}x${value_count} ${stage}" "${source}")
+  endforeach()
+  target_link_libraries(${target}_extern PRIVATE ${target}_instance)
+
+  add_custom_target(${target})
+  list(TRANSFORM stages PREPEND ${target}_)
+  add_dependencies(${target} ${stages})
+endfunction()
@@ -0,0 +1,44 @@
+#include <ctclp.hpp>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measures the runtime floating-point conversion (std::from_chars), the constexpr conversion
+// evaluated at runtime and strtod on the same set of decimal strings.
+
+template <typename convert_t>
+auto measure(char const* name, std::vector<std::string> const& inputs, convert_t convert) -> void {
+  constexpr auto rounds = 10;
+  double checksum{0};
+  auto const start = std::chrono::steady_clock::now();
+  for (auto round = 0; round < rounds; ++round) {
+    for (auto const& input : inputs) { checksum += convert(input); }
+  }
+  auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+  std::printf("%-28s %8.2f ns/value (checksum %g)\n", name, elapsed.count() / (rounds * inputs.size()), checksum);
+}
+
+auto main() -> int {
+  std::mt19937_64 random{42};
+  std::uniform_real_distribution<double> short_values{0.0, 1000.0};
+  std::vector<std::string> inputs{};
+  std::array<char, 64> buffer{};
+  for (auto i = 0; i < 100'000; ++i) {
+    auto const value = i % 2 == 0 ? short_values(random) : std::bit_cast<double>(random() >> 2);
+    auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    inputs.emplace_back(buffer.data(), result.ptr);
+  }
+
+  measure("to_floating_point", inputs, [](auto const& input) { 
+    return *ctclp::to_floating_point<double>(input); });
+  measure("decimal_to_floating_point", inputs, [](auto const& input) { 
+    return *ctclp::decimal_to_floating_point<double>(input); });
+  measure("strtod", inputs, [](auto const& input) { 
+    return std::strtod(input.c_str(), nullptr); });
+}
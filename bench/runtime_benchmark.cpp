@@ -0,0 +1,198 @@
+#include <ctclp.hpp>
+#include <ctclp_batch.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Measures parse latency, get latency per type, batch parse latency per record and heap allocations
+// for generated configurations of 1-512 options and argument lists of 1-4096 entries. Results are
+// written to stdout as JSON lines (default) or CSV (--csv).
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+}
+
+auto operator new(std::size_t size) -> void* {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (auto* pointer = std::malloc(size == 0 ? 1 : size)) { return pointer; }
+  throw std::bad_alloc{};
+}
+
+auto operator delete(void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, std::size_t) noexcept -> void { std::free(pointer); }
+
+namespace {
+
+template <size_t idx>
+consteval auto option_name() noexcept {
+  char name[] = "opt0000";
+  for (auto pos = 6, value = static_cast<int>(idx); pos > 2; --pos, value /= 10) { name[pos] = '0' + value % 10; }
+  return ctclp::literal_string{name};
+}
+
+template <size_t idx>
+consteval auto option_kind() noexcept { return static_cast<ctclp::option::type>(idx % 3); }
+
+template <size_t... idx>
+consteval auto make_options(std::index_sequence<idx...>) noexcept {
+  ctclp::options<sizeof...(idx)> opts{};
+  ([&]() consteval {
+    if constexpr (option_kind<idx>() == ctclp::option::integral) {
+      opts.template add<option_name<idx>(), ctclp::option::integral, ctclp::range<0, 1'000'000>, 
+                        ctclp::default_value<"0">>();
+    } else if constexpr (option_kind<idx>() == ctclp::option::floating_point) {
+      opts.template add<option_name<idx>(), ctclp::option::floating_point, ctclp::range<0.0, 1e6>, 
+                        ctclp::default_value<"0.5">>();
+    } else {
+      opts.template add<option_name<idx>(), ctclp::option::string, ctclp::values<"alpha", "beta", "gamma">, 
+                        ctclp::default_value<"alpha">>();
+    }
+  }(), ...);
+  return opts;
+}
+
+template <size_t option_count>
+inline constexpr auto generated_options = make_options(std::make_index_sequence<option_count>{});
+
+struct measurement {
+  double nanoseconds{};
+  double allocations{};
+};
+
+template <typename function_t>
+auto measure(std::size_t iterations, function_t function) -> measurement {
+  std::array<double, 5> samples{};
+  double allocations{};
+  for (auto& sample : samples) {
+    auto const allocations_before = allocation_count.load(std::memory_order_relaxed);
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) { function(); }
+    auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    sample = elapsed.count() / static_cast<double>(iterations);
+    allocations = static_cast<double>(allocation_count.load(std::memory_order_relaxed) - allocations_before) / 
+                  static_cast<double>(iterations);
+  }
+  std::ranges::sort(samples);
+  return {samples[samples.size() / 2], allocations};
+}
+
+template <typename value_t>
+auto do_not_optimize(value_t const& value) -> void { asm volatile("" : : "r,m"(value) : "memory"); }
+
+struct reporter {
+
+  bool csv{false};
+
+  auto header() const -> void {
+    if (csv) { std::printf("benchmark,options,arguments,type,ns,allocations\n"); }
+  }
+
+  auto report(char const* benchmark, std::size_t options, std::size_t arguments, char const* type, 
+              measurement const& result) const -> void {
+    if (csv) {
+      std::printf("%s,%zu,%zu,%s,%.2f,%.3g\n", benchmark, options, arguments, type, result.nanoseconds, result.allocations);
+    } else {
+      std::printf("{\"benchmark\":\"%s\",\"options\":%zu,\"arguments\":%zu,\"type\":\"%s\","
+                  "\"ns\":%.2f,\"allocations\":%.3g}\n", 
+                  benchmark, options, arguments, type, result.nanoseconds, result.allocations);
+    }
+  }
+
+};
+
+template <size_t option_count>
+auto make_arguments(std::size_t argument_count) -> std::vector<std::string> {
+  constexpr std::array<std::string_view, 3> strings{"alpha", "beta", "gamma"};
+  std::vector<std::string> arguments{"ctclp_bench"};
+  for (std::size_t i = 0; i < argument_count; ++i) {
+    auto const idx = i % option_count;
+    char name[] = "opt0000";
+    for (auto pos = 6, value = static_cast<int>(idx); pos > 2; --pos, value /= 10) { name[pos] = '0' + value % 10; }
+    std::string value{};
+    switch (idx % 3) {
+      case 0: value = std::to_string(i * 7919 % 1'000'000); break;
+      case 1: value = std::to_string(static_cast<double>(i % 1000) * 0.25); break;
+      default: value = strings[i % strings.size()]; break;
+    }
+    arguments.push_back("--" + std::string{name} + "=" + value);
+  }
+  return arguments;
+}
+
+template <size_t option_count>
+auto run(reporter const& output) -> void {
+  using parser = ctclp::parser<generated_options<option_count>>;
+  using batch_parser = ctclp::batch_parser<generated_options<option_count>>;
+
+  for (std::size_t argument_count : {1, 16, 256, 4096}) {
+    auto const arguments = make_arguments<option_count>(argument_count);
+    std::vector<char const*> argv{};
+    for (auto const& argument : arguments) { argv.push_back(argument.c_str()); }
+    auto const argc = static_cast<int>(argv.size());
+
+    auto const iterations = std::max<std::size_t>(1, 200'000 / argument_count);
+    output.report("parse", option_count, argument_count, "all", measure(iterations, [&] {
+      auto result = parser::try_parse(argc, argv.data());
+      do_not_optimize(result);
+    }));
+  }
+
+  {
+    constexpr std::size_t record_count{4096};
+    auto const record_arguments = make_arguments<option_count>(16);
+    std::vector<std::string_view> const record(std::next(record_arguments.begin()), record_arguments.end());
+    std::vector<std::span<std::string_view const>> const records(record_count, record);
+    std::vector<typename parser::parser_result_t> results{};
+    for (std::size_t thread_count : {std::size_t{1}, std::size_t{std::max(1u, std::thread::hardware_concurrency())}}) {
+      auto const type = "threads_" + std::to_string(thread_count);
+      // Per record, so the cost of starting the threads is spread over the records like the parse time.
+      auto const result = measure(4, [&] { do_not_optimize(batch_parser::try_parse(records, results, thread_count)); });
+      output.report("batch", option_count, 16, type.c_str(), 
+                    {result.nanoseconds / record_count, result.allocations / record_count});
+    }
+  }
+
+  auto const arguments = make_arguments<option_count>(option_count);
+  std::vector<char const*> argv{};
+  for (auto const& argument : arguments) { argv.push_back(argument.c_str()); }
+  auto const result = parser::try_parse(static_cast<int>(argv.size()), argv.data());
+
+  constexpr auto last_of_kind = [](ctclp::option::type kind) {
+    return option_count - 1 - (option_count - 1 + 3 - kind) % 3;
+  };
+  output.report("get", option_count, option_count, "integral", measure(1'000'000, [&] {
+    do_not_optimize(result.template get<option_name<last_of_kind(ctclp::option::integral)>(), int>());
+  }));
+  if constexpr (option_count > 1) {
+    output.report("get", option_count, option_count, "floating_point", measure(1'000'000, [&] {
+      do_not_optimize(result.template get<option_name<last_of_kind(ctclp::option::floating_point)>(), double>());
+    }));
+  }
+  if constexpr (option_count > 2) {
+    output.report("get", option_count, option_count, "string", measure(1'000'000, [&] {
+      do_not_optimize(result.template get<option_name<last_of_kind(ctclp::option::string)>(), std::string_view>());
+    }));
+  }
+}
+
+}
+
+auto main(int argc, char** argv) -> int {
+  reporter const output{argc > 1 && std::string_view{argv[1]} == "--csv"};
+  output.header();
+  run<1>(output);
+  run<8>(output);
+  run<64>(output);
+  run<512>(output);
+}
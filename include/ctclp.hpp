@@ -1,51 +1,33 @@
 #pragma once
 
-#include <ctre.hpp>
 #include <ranges>
-#include <string>
 #include <string_view>
 #include <array>
+#include <span>
 #include <algorithm>
 #include <ostream>
 #include <tuple>
 #include <concepts>
 #include <cstring>
+#include <cstdint>
+#include <bit>
+#include <optional>
+#include <limits>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <utility>
+#include <functional>
+#include <cstdlib>
 #include <iostream>
+#include <bitset>
+#include <variant>
+#include <atomic>
+#include <chrono>
 
 namespace ctclp {
 
 namespace rng = std::ranges;
-using ctll::fixed_string;
-
-template <auto value> consteval auto& to_static() { return value; }
-
-template <auto max_size, auto string_builder> 
-consteval auto to_string_view() {
-  constexpr auto intermediate_data = [] {   
-    std::array<char, max_size> max_size_array{};
-    auto const end_pos = rng::copy(string_builder(), rng::begin(max_size_array));
-    auto const right_size = rng::distance(rng::cbegin(max_size_array), end_pos.out);
-    return std::pair{max_size_array, right_size};
-  }();
-
-  constexpr auto right_size_array = [&] {
-    std::array<char, intermediate_data.second + 1> right_size_array{};
-    rng::copy_n(rng::cbegin(intermediate_data.first), intermediate_data.second,
-                rng::begin(right_size_array));
-    right_size_array[intermediate_data.second] = '\0';
-    return right_size_array; 
-  }();
-
-  return std::string_view{to_static<right_size_array>()}; 
-}
-
-template <auto max_size, auto string_builder> 
-consteval auto to_array() {
-  std::array<char, max_size> max_size_array{};
-  auto const end_pos = rng::copy(string_builder(), rng::begin(max_size_array));
-  auto const right_size = rng::distance(rng::cbegin(max_size_array), end_pos.out);
-  return std::pair{max_size_array, right_size};
-}
 
 template <size_t size>
 struct literal_string {
@@ -54,10 +36,6 @@ struct literal_string {
     rng::copy_n(str, size, rng::begin(data)); 
   }
 
-  constexpr auto to_string() const noexcept {
-    return std::string{rng::begin(data), std::prev(rng::end(data))};
-  }
-
   constexpr auto to_string_view() const noexcept {
     return std::string_view{data.data(), size};
   }
@@ -70,9 +48,16 @@ struct literal_string {
 
 };
 
+struct number_format {
+
+  bool prefixes{false};
+  bool separators{false};
+
+};
+
 struct option {
 
-  enum type : size_t { integral, floating_point, string };
+  enum type : std::uint8_t { integral, floating_point, string };
   
   friend auto operator<<(std::ostream& os, type const& opt_type) -> std::ostream& {
     constexpr std::array<std::string_view, 3> type_messages {"integral", "floating_point", "string"};
@@ -81,14 +66,40 @@ struct option {
   }
   
   constexpr option() = default;
-  constexpr option(std::string_view name, type value, std::string_view defval, std::string_view regex)
-    : name{name.data()}, value{value}, defval{defval.data()}, regex{regex.data()} 
+  constexpr option(std::string_view name, type value, std::string_view defval, 
+                   std::span<std::string_view const> allowed_values)
+    : name{name.data()}, defval{defval.data()}, allowed_values{allowed_values.data()}, 
+      allowed_count{allowed_values.size()}, value{value}
+  {}
+
+  constexpr option(std::string_view name, type value, std::string_view defval, 
+                   long long integral_min, long long integral_max, number_format format)
+    : name{name.data()}, defval{defval.data()}, integral_min{integral_min}, integral_max{integral_max}, 
+      value{value}, ranged{true}, format{format}
+  {}
+
+  constexpr option(std::string_view name, type value, std::string_view defval, 
+                   double floating_min, double floating_max, number_format format)
+    : name{name.data()}, defval{defval.data()}, floating_min{floating_min}, floating_max{floating_max}, 
+      value{value}, ranged{true}, format{format}
   {}
 
   char const* name{};
-  type value{};
   char const* defval{};
-  char const* regex{};
+  char const* env{""};
+  char const* implicit{""};
+  std::string_view const* allowed_values{};
+  size_t allowed_count{};
+  size_t max_count{0};
+  long long integral_min{};
+  long long integral_max{};
+  double floating_min{};
+  double floating_max{};
+  type value{};
+  bool ranged{false};
+  bool positional{false};
+  char short_name{'\0'};
+  number_format format{};
 
 };
 
@@ -96,6 +107,10 @@ template <literal_string... opt_values>
 struct values {
 
   using values_t = void;
+
+  static constexpr std::array<std::string_view, sizeof...(opt_values)> views{
+    opt_values.to_view_remove_suffix()...
+  };
   
   constexpr auto as_tuple() const noexcept {
     return std::tie(opt_values...);
@@ -110,19 +125,59 @@ concept option_values = requires {
 
 };
 
+template <auto min, auto max, number_format format = number_format{}> 
+struct range {
+
+  static_assert(min <= max, "Range minimum must not exceed its maximum.");
+
+  using range_t = void;
+
+  static constexpr auto minimum = min;
+  static constexpr auto maximum = max;
+  static constexpr auto number_format = format;
+
+};
+
+using any_integral = range<std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max()>;
+using any_floating_point = range<std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max()>;
+
+template <typename opt_range_t> 
+concept option_range = requires { 
+
+  typename opt_range_t::range_t; 
+
+};
+
+struct any_string {
+
+  using any_string_t = void;
+
+};
+
+template <typename opt_any_string_t> 
+concept option_any_string = requires { 
+
+  typename opt_any_string_t::any_string_t; 
+
+};
+
+template <typename opt_constraint_t> 
+concept option_constraint = option_values<opt_constraint_t> || option_range<opt_constraint_t> || 
+                            option_any_string<opt_constraint_t>;
+
 template <literal_string value> 
 struct default_value {
 
   using default_value_t = void;
 
-  constexpr auto to_string() const noexcept {
-    return value.to_string();
-  }
-
   constexpr auto to_string_view() const noexcept {
     return value.to_string_view();
   }
 
+  constexpr auto to_view_remove_suffix() const noexcept {
+    return value.to_view_remove_suffix();
+  }
+
 };
 
 template <typename opt_default_value_t> 
@@ -132,302 +187,2247 @@ concept option_default_value = requires {
 
 };
 
-template <auto oversized_array, size_t right_size>
-constexpr auto to_right_size() {
-  std::array<char, right_size> result{};
-  rng::copy_n(rng::begin(oversized_array), right_size, rng::begin(result));
-  return result;
-}
+template <literal_string name> 
+struct env {
 
-template <size_t size>
-constexpr auto to_char_array(const char* str) {
-  std::array<char, size> result{};
-  rng::copy_n(str, size, rng::begin(result));
-  return result;
-}
+  using env_t = void;
 
-constexpr auto strlen(char const* start) -> size_t {
-    char const* end = start;
-    while (*end != '\0') { ++end; }
-    return end - start;
-}
+  constexpr auto to_string_view() const noexcept {
+    return name.to_string_view();
+  }
 
-template <auto capacity>
-struct options {
+};
 
-  constexpr options() = default;
+template <typename opt_env_t> 
+concept option_env = requires { 
 
-  template <literal_string opt_name, option::type opt_type, option_values opt_values, 
-            option_default_value opt_default_value = default_value<"">> 
-  consteval auto add() noexcept {
-    static_assert([&] {
-      return std::apply([&](auto const&... values) {
-        if (opt_default_value{}.to_string().empty()) { return true; }
-        bool is_valid{false};
-        ((is_valid += (values.to_string() == opt_default_value{}.to_string())), ...);
-        return is_valid;
-      }, opt_values{}.as_tuple());
-    }(), "Default value does not match any of the provided values.");
-      
-    constexpr auto opt_regex = to_string_view<128, [] {
-       return std::apply([](auto const&... values) {
-        size_t cnt{sizeof...(values)};
-        auto result = std::string{"^\\s*--"} + opt_name.to_string() + "=(?<" 
-                                             + opt_name.to_string() + ">(";
-        ((result += values.to_string() + (--cnt ? "|" : "")) , ...);
-        return result.append("))\\s*$");
-      }, opt_values{}.as_tuple());
-    }>();
-
-    data[size++] = option{opt_name.to_string_view(), opt_type, 
-                          opt_default_value{}.to_string_view(), 
-                          opt_regex};
-    return *this;
-  }
+  typename opt_env_t::env_t; 
 
-  constexpr auto begin() const noexcept { return data.begin(); }
-  constexpr auto end() const noexcept { return std::next(begin(), size); }
+};
 
-  size_t size{0};
-  std::array<option, capacity> data{};
+template <size_t max_count> 
+struct repeat {
+
+  static_assert(max_count > 0, "Repeated options must allow at least one value.");
+
+  using repeat_t = void;
+
+  static constexpr size_t count = max_count;
 
 };
 
-enum class error_code { parse_error, option_not_found, incorrect_type, conversion_error, unknown_type };
+template <typename opt_repeat_t> 
+concept option_repeat = requires { 
 
-auto operator<<(std::ostream& os, error_code const& ec) -> std::ostream& {
-  constexpr std::array<std::string_view, 5> error_messages {"parse_error", "option_not_found", 
-                                                            "incorrect_type", "conversion_error", 
-                                                            "unknown_type"};
-  auto const num = static_cast<int>(ec);
-  return os << "Error code: " << num << " (" << error_messages[num] << ")";
-}
+  typename opt_repeat_t::repeat_t; 
 
-using parse_error_info = std::tuple<std::string_view, error_code>;
+};
 
-template <size_t max_size>
-struct parse_errors {    
+template <char name> 
+struct short_name {
 
-  constexpr auto begin() const noexcept { return data.begin(); }
-  constexpr auto end() const noexcept { return std::next(begin(), right_size); }
+  static_assert(name != '\0' && name != '-' && name != '=', "Short names must be a printable character.");
 
-  constexpr auto append(parse_error_info const& error_info) noexcept -> parse_errors& {
-    data[right_size++] = error_info;
-    return *this;
-  }
+  using short_name_t = void;
 
-  std::array<parse_error_info, max_size> data{};
-  size_t right_size{0};
+  static constexpr char value = name;
 
-  friend auto operator<<(std::ostream& os, parse_errors const& errors) noexcept -> std::ostream& {
-    os << "Errors:\n";
-    for (auto const& error_info : errors) {
-      os << "  " << std::get<0>(error_info) 
-         << ", " << std::get<1>(error_info)
-         << '\n';
-    }
-    return os;
+};
+
+template <typename opt_short_name_t> 
+concept option_short_name = requires { 
+
+  typename opt_short_name_t::short_name_t; 
+
+};
+
+template <literal_string value> 
+struct implicit_value {
+
+  using implicit_value_t = void;
+
+  constexpr auto to_string_view() const noexcept {
+    return value.to_string_view();
   }
-    
+
+  constexpr auto to_view_remove_suffix() const noexcept {
+    return value.to_view_remove_suffix();
+  }
+
 };
 
-constexpr auto llabs(long long exp) noexcept -> long long {
-  return exp < 0 ? -exp : exp;
-}
+template <typename opt_implicit_value_t> 
+concept option_implicit_value = requires { 
+
+  typename opt_implicit_value_t::implicit_value_t; 
+
+};
+
+struct positional {
+
+  using positional_t = void;
+
+};
+
+template <typename opt_positional_t> 
+concept option_positional = requires { 
+
+  typename opt_positional_t::positional_t; 
+
+};
+
+template <typename opt_attribute_t> 
+concept option_attribute = option_default_value<opt_attribute_t> || option_env<opt_attribute_t> || 
+                           option_repeat<opt_attribute_t> || option_short_name<opt_attribute_t> || 
+                           option_implicit_value<opt_attribute_t> || option_positional<opt_attribute_t>;
+
+template <typename... opt_attributes_t>
+struct default_attribute { using type = default_value<"">; };
+
+template <option_default_value first_t, typename... rest_t>
+struct default_attribute<first_t, rest_t...> { using type = first_t; };
+
+template <typename first_t, typename... rest_t>
+struct default_attribute<first_t, rest_t...> : default_attribute<rest_t...> {};
+
+template <typename... opt_attributes_t>
+struct env_attribute { using type = env<"">; };
+
+template <option_env first_t, typename... rest_t>
+struct env_attribute<first_t, rest_t...> { using type = first_t; };
+
+template <typename first_t, typename... rest_t>
+struct env_attribute<first_t, rest_t...> : env_attribute<rest_t...> {};
+
+template <typename... opt_attributes_t>
+struct repeat_attribute { static constexpr size_t count{0}; };
+
+template <option_repeat first_t, typename... rest_t>
+struct repeat_attribute<first_t, rest_t...> { static constexpr size_t count{first_t::count}; };
+
+template <typename first_t, typename... rest_t>
+struct repeat_attribute<first_t, rest_t...> : repeat_attribute<rest_t...> {};
+
+template <typename... opt_attributes_t>
+struct short_name_attribute { static constexpr char value{'\0'}; };
 
-constexpr auto pow_base10(long long exp) noexcept {
-  long double result{1};
-  for (auto i : std::views::iota(0, llabs(exp))) {result *= 10; }
-  return exp < 0 ? 1/result : result;
+template <option_short_name first_t, typename... rest_t>
+struct short_name_attribute<first_t, rest_t...> { static constexpr char value{first_t::value}; };
+
+template <typename first_t, typename... rest_t>
+struct short_name_attribute<first_t, rest_t...> : short_name_attribute<rest_t...> {};
+
+template <typename... opt_attributes_t>
+struct implicit_attribute { using type = implicit_value<"">; };
+
+template <option_implicit_value first_t, typename... rest_t>
+struct implicit_attribute<first_t, rest_t...> { using type = first_t; };
+
+template <typename first_t, typename... rest_t>
+struct implicit_attribute<first_t, rest_t...> : implicit_attribute<rest_t...> {};
+
+constexpr auto digit_value(char c) noexcept -> std::uintmax_t {
+  if ('0' <= c && c <= '9') { return static_cast<std::uintmax_t>(c - '0'); }
+  if ('a' <= c && c <= 'f') { return static_cast<std::uintmax_t>(c - 'a' + 10); }
+  if ('A' <= c && c <= 'F') { return static_cast<std::uintmax_t>(c - 'A' + 10); }
+  return std::numeric_limits<std::uintmax_t>::max();
 }
 
-constexpr auto to_double(long long int_part, long long frac_part, unsigned int frac_digits) noexcept {
-  long double fraction = frac_part / pow_base10(frac_digits);
-  return int_part + (int_part >= 0 ? fraction : -fraction);
+inline auto eight_digits(std::string_view str) noexcept -> std::optional<std::uint64_t> {
+  std::uint64_t chunk{};
+  std::memcpy(&chunk, str.data(), sizeof(chunk));
+  if ((chunk & 0xF0F0F0F0F0F0F0F0) != 0x3030303030303030 || 
+      ((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) != 0x3030303030303030) { return std::nullopt; }
+  chunk -= 0x3030303030303030;
+  chunk = chunk * 10 + (chunk >> 8);
+  return (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) + 
+          (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
 }
 
-template <std::integral result_t>
-constexpr auto to_integral(std::string_view str) noexcept -> std::optional<result_t>{
+template <std::integral result_t, number_format format = number_format{}>
+constexpr auto to_integral(std::string_view str) noexcept -> std::optional<result_t> {
   bool is_negative{false};
   if (str.starts_with('-')) { is_negative = true; str.remove_prefix(1); }
-  if (!rng::all_of(str, [](auto c) { return c <= '9' && '0' <= c; })) { 
-    return std::nullopt; 
+
+  std::uintmax_t base{10};
+  if constexpr (format.prefixes) {
+    constexpr std::array<std::pair<std::string_view, std::uintmax_t>, 6> prefixes{{
+      {"0x", 16}, {"0X", 16}, {"0o", 8}, {"0O", 8}, {"0b", 2}, {"0B", 2}
+    }};
+    auto const prefix = rng::find_if(prefixes, [&](auto const& prefix) { return str.starts_with(prefix.first); });
+    if (prefix != rng::end(prefixes)) { base = prefix->second; str.remove_prefix(prefix->first.size()); }
+  }
+  if (str.empty()) { return std::nullopt; }
+
+  constexpr auto max_value = static_cast<std::uintmax_t>(std::numeric_limits<result_t>::max());
+  auto const limit = !is_negative ? max_value : std::signed_integral<result_t> ? max_value + 1 : 0;
+
+  std::uintmax_t result{};
+  bool after_digit{false};
+  while (!str.empty()) {
+    if constexpr (std::endian::native == std::endian::little && sizeof(std::uintmax_t) == sizeof(std::uint64_t)) {
+      if !consteval {
+        auto const chunk = base == 10 && str.size() >= 8 ? eight_digits(str) : std::nullopt;
+        if (chunk) {
+          if (*chunk > limit || result > (limit - *chunk) / 100'000'000) { return std::nullopt; }
+          result = result * 100'000'000 + *chunk;
+          after_digit = true;
+          str.remove_prefix(8);
+          continue;
+        }
+      }
+    }
+    auto const c = str.front();
+    str.remove_prefix(1);
+    if (format.separators && c == '_') {
+      if (!after_digit || str.empty()) { return std::nullopt; }
+      after_digit = false;
+      continue;
+    }
+    auto const digit = digit_value(c);
+    if (digit >= base) { return std::nullopt; }
+    if (digit > limit || result > (limit - digit) / base) { return std::nullopt; }
+    result = result * base + digit; 
+    after_digit = true;
   }
-  result_t result{};
-  for (auto c : str) { result = result * 10 + (c - '0'); }
-  return is_negative ? -result : result;
+  return static_cast<result_t>(is_negative ? 0 - result : result);
 }
 
-template <options opts, size_t capacity>
-class parser {
-public:    
-    
-  template <size_t argc>
-  class parser_result_t {
-  public:
+struct big_integer {
 
-    template <options, size_t> friend class parser;
-        
-    constexpr operator bool() const noexcept { return !errors.right_size; }
+  static constexpr size_t capacity{96};
 
-    template <literal_string opt, typename opt_type>
-    constexpr auto get() const noexcept -> std::pair<std::optional<opt_type>, 
-                                                     std::optional<error_code>> {        
-      auto const m_pos = rng::find_if(options_map, [](std::string str) { 
-        return str == opt.to_string(); }, [](auto const& pair) { 
-          return pair.first.name; });
-          
-      if (m_pos != rng::end(options_map)) {
-        return convert_raw_value<opt_type>(m_pos->first, m_pos->second);
-      }
+  constexpr auto multiply_add(std::uint32_t factor, std::uint32_t addend) noexcept -> void {
+    std::uint64_t carry{addend};
+    for (auto& limb : rng::subrange{rng::begin(limbs), std::next(rng::begin(limbs), size)}) {
+      auto const product = std::uint64_t{limb} * factor + carry;
+      limb = static_cast<std::uint32_t>(product);
+      carry = product >> 32;
+    }
+    if (carry != 0) { limbs[size++] = static_cast<std::uint32_t>(carry); }
+  }
 
-      auto const options = rng::subrange{rng::begin(opts), rng::end(opts)};
-      auto const o_pos = rng::find_if(options, [](std::string str) { 
-        return str == opt.to_string(); }, &option::name);
+  constexpr auto multiply_pow5(size_t exp) noexcept -> void {
+    for (; exp >= 13; exp -= 13) { multiply_add(1220703125, 0); }
+    std::uint32_t factor{1};
+    for (; exp > 0; --exp) { factor *= 5; }
+    multiply_add(factor, 0);
+  }
 
-      if (o_pos == rng::end(options)) { return {{}, error_code::option_not_found}; }
-            
-      auto const default_value = std::string_view{o_pos->defval};
-      if (default_value.empty()) { return {{}, error_code::option_not_found}; }
+  constexpr auto shift_left(size_t bits) noexcept -> void {
+    if (size == 0) { return; }
+    auto const limb_shift = bits / 32;
+    auto const bit_shift = bits % 32;
+    if (bit_shift != 0) {
+      auto const top = limbs[size - 1] >> (32 - bit_shift);
+      for (auto idx = size - 1; idx > 0; --idx) {
+        limbs[idx] = (limbs[idx] << bit_shift) | (limbs[idx - 1] >> (32 - bit_shift));
+      }
+      limbs[0] <<= bit_shift;
+      if (top != 0) { limbs[size++] = top; }
+    }
+    if (limb_shift != 0) {
+      std::shift_right(rng::begin(limbs), std::next(rng::begin(limbs), size + limb_shift), limb_shift);
+      rng::fill_n(rng::begin(limbs), limb_shift, 0);
+      size += limb_shift;
+    }
+  }
 
-      return convert_raw_value<opt_type>(*o_pos, default_value);            
+  constexpr auto subtract(big_integer const& other) noexcept -> void {
+    std::int64_t borrow{0};
+    for (auto idx : std::views::iota(size_t{0}, size)) {
+      auto const difference = std::int64_t{limbs[idx]} - (idx < other.size ? other.limbs[idx] : 0) - borrow;
+      borrow = difference < 0;
+      limbs[idx] = static_cast<std::uint32_t>(difference + (borrow << 32));
     }
+    while (size != 0 && limbs[size - 1] == 0) { --size; }
+  }
+
+  constexpr auto bit_length() const noexcept -> size_t {
+    return size == 0 ? 0 : 32 * (size - 1) + std::bit_width(limbs[size - 1]);
+  }
 
-    parse_errors<opts.size> errors{};
+  constexpr auto bits_from(size_t first) const noexcept -> std::uint64_t {
+    std::uint64_t result{};
+    for (auto bit : std::views::iota(first, bit_length()) | std::views::reverse) {
+      result = (result << 1) | ((limbs[bit / 32] >> (bit % 32)) & 1);
+    }
+    return result;
+  }
 
-  private:
+  constexpr auto any_bits_below(size_t last) const noexcept -> bool {
+    auto const full_limbs = std::min(last / 32, size);
+    if (rng::any_of(rng::subrange{rng::begin(limbs), std::next(rng::begin(limbs), full_limbs)}, 
+                    [](auto limb) { return limb != 0; })) { return true; }
+    return full_limbs < size && last % 32 != 0 && (limbs[full_limbs] & ((1u << (last % 32)) - 1)) != 0;
+  }
 
-    constexpr parser_result_t() = default;
-        
-    template <typename opt_type>
-    constexpr auto convert_raw_value(option const& opt, std::string_view raw_opt_value) const noexcept
-    -> std::pair<std::optional<opt_type>, std::optional<error_code>> {        
-      if constexpr (std::integral<opt_type>) {
-        if (opt.value != option::integral) { return {{}, error_code::incorrect_type}; }
-        auto const match = ctre::match<"[\\-]?(0|[1-9]\\d*)">(raw_opt_value);
-        if (!match) { return {{}, error_code::conversion_error}; }
-        auto const opt_integral = to_integral<opt_type>(match.to_view());
-        if (!opt_integral) { return {{}, error_code::conversion_error}; }
-        return {*opt_integral, {}};
-      } else if constexpr (std::is_same_v<opt_type, std::string_view>) { 
-        if (opt.value != option::string) { return {{}, error_code::incorrect_type}; }
-        return {raw_opt_value, {}};
-      }  else if constexpr (std::floating_point<opt_type>) { 
-        if (opt.value != option::floating_point) { return {{}, error_code::incorrect_type}; }
-        return raw_value_as_double(raw_opt_value);
-      } else {
-        return {{}, error_code::unknown_type};
-      }
+  friend constexpr auto operator<=>(big_integer const& lhs, big_integer const& rhs) noexcept {
+    if (lhs.size != rhs.size) { return lhs.size <=> rhs.size; }
+    for (auto idx : std::views::iota(size_t{0}, lhs.size) | std::views::reverse) {
+      if (lhs.limbs[idx] != rhs.limbs[idx]) { return lhs.limbs[idx] <=> rhs.limbs[idx]; }
     }
-    
-    constexpr auto raw_value_as_double(std::string_view str) const noexcept 
-    -> std::pair<std::optional<long double>, std::optional<error_code>> {        
-      auto const match = ctre::match<"([\\-]?(?:0|[1-9]\\d*))(?:\\.(\\d*))?">(str);
-      if (!match) { return {{}, error_code::conversion_error}; }
+    return std::strong_ordering::equal;
+  }
 
-      auto const opt_int_part = to_integral<long long>(match.get<1>().to_view());
-      if (!opt_int_part) { return {{}, error_code::conversion_error}; }
-      long long int_part = *opt_int_part;
+  std::array<std::uint32_t, capacity> limbs{};
+  size_t size{0};
+
+};
+
+struct decimal_number {
 
-      auto const frac_part_view = match.get<2>().to_view();
-      if (frac_part_view.empty()) { return {{static_cast<long double>(int_part)}, {}}; } 
+  static constexpr size_t max_digits{800};
 
-      auto const opt_frac_part = to_integral<long long>(frac_part_view);
-      long long frac_part = *opt_frac_part;
+  bool is_negative{false};
+  big_integer mantissa{};
+  size_t digit_count{0};
+  long long exponent{0};
 
-      auto frac_digit = frac_part_view.size();
-      if (str.starts_with("-0.")) { frac_part = -frac_part; }
+};
 
-      return {{to_double(int_part, frac_part, frac_digit)}, {}};    
+constexpr auto to_decimal_number(std::string_view str) noexcept -> std::optional<decimal_number> {
+  decimal_number number{};
+  if (str.starts_with('-')) { number.is_negative = true; str.remove_prefix(1); }
+
+  auto const is_digit = [](char c) { return '0' <= c && c <= '9'; };
+  bool has_digits{false}, is_truncated{false}, is_fraction{false};
+  for (; !str.empty() && (is_digit(str.front()) || (str.front() == '.' && !is_fraction)); str.remove_prefix(1)) {
+    if (str.front() == '.') { is_fraction = true; continue; }
+    has_digits = true;
+    auto const digit = static_cast<std::uint32_t>(str.front() - '0');
+    if (number.digit_count == 0 && digit == 0) { number.exponent -= is_fraction; continue; }
+    if (number.digit_count == decimal_number::max_digits) {
+      is_truncated = is_truncated || digit != 0;
+      number.exponent += !is_fraction;
+      continue;
     }
-        
-    std::array<std::pair<option, std::string_view>, argc> options_map{};
+    number.mantissa.multiply_add(10, digit);
+    ++number.digit_count;
+    number.exponent -= is_fraction;
+  }
+  if (!has_digits) { return std::nullopt; }
+
+  if (!str.empty() && (str.front() == 'e' || str.front() == 'E')) {
+    str.remove_prefix(1);
+    bool const is_negative_exponent = str.starts_with('-');
+    if (str.starts_with('-') || str.starts_with('+')) { str.remove_prefix(1); }
+    if (str.empty()) { return std::nullopt; }
+    long long exponent{0};
+    for (auto c : str) {
+      if (!is_digit(c)) { return std::nullopt; }
+      exponent = std::min(exponent * 10 + (c - '0'), 100'000LL);
+    }
+    number.exponent += is_negative_exponent ? -exponent : exponent;
+  } else if (!str.empty()) { 
+    return std::nullopt; 
+  }
 
-  };
+  if (is_truncated) {
+    number.mantissa.multiply_add(10, 1);
+    ++number.digit_count;
+    --number.exponent;
+  }
+  return number;
+}
 
-  template <size_t argc, auto argv>
-  static constexpr auto try_parse() noexcept {
-    return parser{}.parse<argc-1>(argv+1, std::make_index_sequence<argc-1>{});
+template <std::floating_point result_t>
+constexpr auto scale_by_pow2(result_t value, long long exp) noexcept -> result_t {
+  constexpr auto step = static_cast<result_t>(std::uint64_t{1} << 60);
+  for (; exp >= 60; exp -= 60) { value *= step; }
+  for (; exp <= -60; exp += 60) { value /= step; }
+  for (; exp > 0; --exp) { value *= 2; }
+  for (; exp < 0; ++exp) { value /= 2; }
+  return value;
+}
+
+template <std::floating_point result_t>
+constexpr auto round_to_floating_point(std::uint64_t bits, long long exp2, bool is_inexact) noexcept 
+-> std::optional<result_t> {
+  using limits = std::numeric_limits<result_t>;
+  auto const msb_exponent = static_cast<long long>(std::bit_width(bits)) - 1 + exp2;
+  auto const precision = std::min<long long>(limits::digits, 
+                                             limits::digits - (limits::min_exponent - 1 - msb_exponent));
+  auto const dropped = std::bit_width(bits) - precision;
+
+  auto mantissa = bits;
+  if (dropped > 64) { return std::nullopt; }
+  if (dropped > 0) {
+    auto const half = std::uint64_t{1} << (dropped - 1);
+    auto const remainder = dropped == 64 ? bits : bits & ((half << 1) - 1);
+    mantissa = dropped == 64 ? 0 : bits >> dropped;
+    exp2 += dropped;
+    if (remainder > half || (remainder == half && (is_inexact || (mantissa & 1) != 0))) { ++mantissa; }
   }
+  if (mantissa == 0) { return std::nullopt; }
+  if (static_cast<long long>(std::bit_width(mantissa)) - 1 + exp2 >= limits::max_exponent) { return std::nullopt; }
+  return scale_by_pow2(static_cast<result_t>(mantissa), exp2);
+}
 
-  template <size_t argc>
-  static constexpr auto try_parse(char const* (&argv)[argc]) noexcept {
-    return parser{}.parse<argc-1>(argv+1, std::make_index_sequence<argc-1>{});
+template <std::floating_point result_t>
+constexpr auto decimal_to_floating_point(std::string_view str) noexcept -> std::optional<result_t> {
+  using limits = std::numeric_limits<result_t>;
+  static_assert(limits::is_iec559 && limits::max_exponent <= 1024, 
+                "Only single and double precision floating-point types are supported.");
+
+  auto const number = to_decimal_number(str);
+  if (!number) { return std::nullopt; }
+  auto const sign = number->is_negative ? result_t{-1} : result_t{1};
+  if (number->digit_count == 0) { return sign * result_t{0}; }
+
+  auto const magnitude = static_cast<long long>(number->digit_count) + number->exponent;
+  if (magnitude > limits::max_exponent10 + 1) { return std::nullopt; }
+  if (magnitude < limits::min_exponent10 - limits::digits10 - 3) { return std::nullopt; }
+
+  constexpr auto max_exact_exponent = [] {
+    long long exp{0};
+    for (std::uint64_t pow5{5}; std::bit_width(pow5) <= limits::digits; pow5 *= 5) { ++exp; }
+    return exp;
+  }();
+  auto const exp10 = number->exponent;
+  if (number->mantissa.bit_length() <= limits::digits && -max_exact_exponent <= exp10 && exp10 <= max_exact_exponent) {
+    result_t pow10{1};
+    for (auto i = exp10 < 0 ? -exp10 : exp10; i > 0; --i) { pow10 *= 10; }
+    auto const mantissa = static_cast<result_t>(number->mantissa.bits_from(0));
+    return sign * (exp10 < 0 ? mantissa / pow10 : mantissa * pow10);
   }
 
-private:
-    
-  constexpr parser() = default;
+  auto scaled = number->mantissa;
+  std::optional<result_t> result{};
+  if (exp10 >= 0) {
+    scaled.multiply_pow5(static_cast<size_t>(exp10));
+    auto const shift = scaled.bit_length() > 64 ? scaled.bit_length() - 64 : 0;
+    result = round_to_floating_point<result_t>(scaled.bits_from(shift), exp10 + static_cast<long long>(shift), 
+                                               scaled.any_bits_below(shift));
+  } else {
+    big_integer divisor{};
+    divisor.multiply_add(1, 1);
+    divisor.multiply_pow5(static_cast<size_t>(-exp10));
+    auto const extra_bits = static_cast<long long>(divisor.bit_length()) - 
+                            static_cast<long long>(scaled.bit_length()) + limits::digits + 2;
+    if (extra_bits >= 0) { scaled.shift_left(static_cast<size_t>(extra_bits)); } 
+    else { divisor.shift_left(static_cast<size_t>(-extra_bits)); }
+
+    auto const quotient_bits = scaled.bit_length() - divisor.bit_length();
+    divisor.shift_left(quotient_bits);
+    std::uint64_t quotient{};
+    for (auto i = quotient_bits + 1; i > 0; --i) {
+      quotient <<= 1;
+      if (scaled >= divisor) { scaled.subtract(divisor); quotient |= 1; }
+      scaled.shift_left(1);
+    }
+    result = round_to_floating_point<result_t>(quotient, exp10 - extra_bits, scaled.size != 0);
+  }
+  if (!result) { return std::nullopt; }
+  return sign * *result;
+}
 
-  template <size_t argc, size_t... idx>
-  constexpr auto parse(auto const& argv, std::index_sequence<idx...>) const noexcept {
-    parser_result_t<argc> result{};
-    (parse_option<idx, argc>(argv, result), ...);
+template <std::floating_point result_t>
+constexpr auto to_floating_point(std::string_view str) noexcept -> std::optional<result_t> {
+  if consteval {
+    return decimal_to_floating_point<result_t>(str);
+  } else {
+    result_t result{};
+    auto const [end, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+    if (ec != std::errc{} || end != str.data() + str.size() || !std::isfinite(result)) { return std::nullopt; }
     return result;
   }
+}
 
-  
-  template <size_t... indx>
-  static constexpr auto get_parse_result(std::string_view input, std::index_sequence<indx...>) noexcept {
-    std::optional<std::pair<size_t, std::string_view>> result{};
-
-    (([&] {
-      if (input.contains(std::get<0>(std::get<indx>(regex_tuple)))) {
-        auto match_result = ctre::match<std::get<2>(std::get<indx>(regex_tuple))>(input);
-        if (match_result) {
-          result = std::optional{
-            std::pair{indx, std::string_view{match_result.template get<std::get<1>(std::get<indx>(regex_tuple))>()}
-          }};
-        }
-      }
-    }()), ...);
-            
-    return result;
+template <option::type opt_type>
+using option_storage_t = std::tuple_element_t<opt_type, std::tuple<long long, double, std::string_view>>;
+
+template <option::type opt_type, number_format format = number_format{}>
+constexpr auto to_storage(std::string_view raw_opt_value) noexcept 
+-> std::optional<option_storage_t<opt_type>> {
+  if constexpr (opt_type == option::integral) {
+    return to_integral<long long, format>(raw_opt_value);
+  } else if constexpr (opt_type == option::floating_point) {
+    return to_floating_point<double>(raw_opt_value);
+  } else {
+    return raw_opt_value;
   }
+}
 
-  template <size_t idx, size_t argc>
-  constexpr auto parse_option(auto const& argv, parser_result_t<argc>& result) const noexcept {        
-    auto parsed_result = get_parse_result(argv[idx], std::make_index_sequence<opts.size>{});
-        
-    if (!parsed_result.has_value()) {
-      result.errors.append(parse_error_info{argv[idx], error_code::parse_error});
-      return; 
-    } 
+template <auto capacity>
+struct options {
+
+  constexpr options() = default;
+
+  template <literal_string opt_name, option::type opt_type, option_constraint opt_values, 
+            option_attribute... opt_attributes> 
+  consteval auto add() noexcept {
+    static_assert((option_default_value<opt_attributes> + ... + 0) <= 1, "Only one default value is allowed.");
+    static_assert((option_env<opt_attributes> + ... + 0) <= 1, "Only one environment variable is allowed.");
+    static_assert((option_repeat<opt_attributes> + ... + 0) <= 1, "Only one repeat count is allowed.");
+    static_assert((option_short_name<opt_attributes> + ... + 0) <= 1, "Only one short name is allowed.");
+    static_assert((option_implicit_value<opt_attributes> + ... + 0) <= 1, "Only one implicit value is allowed.");
+    using opt_default_value = typename default_attribute<opt_attributes...>::type;
+    using opt_env = typename env_attribute<opt_attributes...>::type;
+    using opt_implicit_value = typename implicit_attribute<opt_attributes...>::type;
+
+    static_assert(accepts_value<opt_type, opt_values>(opt_implicit_value{}.to_view_remove_suffix()), 
+                  "Implicit value is not one of the accepted values.");
+
+    if constexpr (option_any_string<opt_values>) {
+      static_assert(opt_type == option::string, "any_string requires a string option.");
+
+      data[size++] = option{opt_name.to_string_view(), opt_type, opt_default_value{}.to_string_view(), {}};
+      data[size - 1].ranged = true;
+    } else if constexpr (option_range<opt_values>) {
+      static_assert(opt_type != option::string, "Ranges require an integral or floating-point option.");
+      static_assert(opt_type != option::integral || (std::integral<decltype(opt_values::minimum)> && 
+                                                     std::integral<decltype(opt_values::maximum)>), 
+                    "Integral options require integral range bounds.");
+
+      static_assert(accepts_value<opt_type, opt_values>(opt_default_value{}.to_view_remove_suffix()), 
+                    "Default value is not within the provided range.");
+
+      using bound_t = option_storage_t<opt_type>;
+      data[size++] = option{opt_name.to_string_view(), opt_type, 
+                            opt_default_value{}.to_string_view(), 
+                            static_cast<bound_t>(opt_values::minimum), 
+                            static_cast<bound_t>(opt_values::maximum), 
+                            opt_values::number_format};
+    } else {
+      static_assert(accepts_value<opt_type, opt_values>(opt_default_value{}.to_view_remove_suffix()), 
+                    "Default value does not match any of the provided values.");
         
-    result.options_map[idx] = std::pair{
-      opts.data[parsed_result->first], parsed_result->second
-    };
+      static_assert([] {
+        auto views = opt_values::views;
+        rng::sort(views);
+        return rng::adjacent_find(views) == rng::end(views);
+      }(), "Allowed values must be unique.");
+
+      static_assert(rng::all_of(opt_values::views, [](auto value) { 
+        return to_storage<opt_type>(value).has_value(); 
+      }), "Allowed values must be convertible to the option type.");
+
+      data[size++] = option{opt_name.to_string_view(), opt_type, 
+                            opt_default_value{}.to_string_view(), 
+                            opt_values::views};
+    }
+    data[size - 1].env = opt_env{}.to_string_view().data();
+    data[size - 1].max_count = repeat_attribute<opt_attributes...>::count;
+    data[size - 1].implicit = opt_implicit_value{}.to_string_view().data();
+    data[size - 1].short_name = short_name_attribute<opt_attributes...>::value;
+    data[size - 1].positional = (option_positional<opt_attributes> || ...);
+    return *this;
   }
 
-public:
-    
-  template <auto regex_array, size_t... idx>
-  static constexpr auto make_regex_tuple(std::index_sequence<idx...>) noexcept {
-    return std::make_tuple(
-      std::tuple{
-        std::string_view{std::string_view{opts.data[idx].name}},
-        fixed_string{to_char_array<strlen(opts.data[idx].name)>(opts.data[idx].name)},  
-        fixed_string{to_right_size<regex_array[idx].first, regex_array[idx].second>()}
-      }...
-    );
-  }
+  constexpr auto begin() const noexcept { return data.begin(); }
+  constexpr auto end() const noexcept { return std::next(begin(), size); }
 
-  template <size_t... idx>
-  static constexpr auto prepare_regex_array(std::index_sequence<idx...>) noexcept {
-    std::array<std::pair<std::array<char, capacity>, size_t>, opts.size> result{};
-    ((result[idx] = to_array<capacity, [] { 
-      return std::string{opts.data[idx].regex}; }>()) , ...);
-    return result;
+  size_t size{0};
+  std::array<option, capacity> data{};
+
+private:
+
+  template <option::type opt_type, option_constraint opt_values>
+  static consteval auto accepts_value(std::string_view value) noexcept -> bool {
+    if (value.empty()) { return true; }
+    if constexpr (option_any_string<opt_values>) {
+      return true;
+    } else if constexpr (option_range<opt_values>) {
+      auto const storage = to_storage<opt_type, opt_values::number_format>(value);
+      return storage && opt_values::minimum <= *storage && *storage <= opt_values::maximum;
+    } else {
+      return rng::find(opt_values::views, value) != rng::end(opt_values::views);
+    }
   }
 
-  static constexpr auto regex_tuple = [] { 
-    constexpr auto regex_array = [] { 
-      return prepare_regex_array(std::make_index_sequence<opts.size>{}); 
-    }();
-    return make_regex_tuple<regex_array>(std::make_index_sequence<opts.size>{});
-  }();
+};
+
+enum class error_code : std::uint8_t { parse_error, option_not_found, incorrect_type, conversion_error, unknown_type, 
+                        out_of_range, response_file_error, repeat_limit_exceeded, missing_value, 
+                        unknown_command };
+
+inline auto operator<<(std::ostream& os, error_code const& ec) -> std::ostream& {
+  constexpr std::array<std::string_view, 10> error_messages {"parse_error", "option_not_found", 
+                                                             "incorrect_type", "conversion_error", 
+                                                             "unknown_type", "out_of_range", 
+                                                             "response_file_error", "repeat_limit_exceeded", 
+                                                             "missing_value", "unknown_command"};
+  auto const num = static_cast<int>(ec);
+  return os << "Error code: " << num << " (" << error_messages[num] << ")";
+}
+
+// argument is the position of the offending argument after the program name (of the @file argument for 
+// errors in a response file, environment for environment variables); option and suggestion index the 
+// names of the parse_errors holding the record.
+struct parse_error_info {
+
+  static constexpr std::uint32_t environment{std::numeric_limits<std::uint32_t>::max()};
+  static constexpr std::uint16_t none{std::numeric_limits<std::uint16_t>::max()};
+
+  std::uint32_t argument{};
+  std::uint16_t option{none};
+  error_code code{};
+  std::uint16_t suggestion{none};
 
 };
 
-} // ctclp
+// capacity 0 stores up to default_capacity errors.
+struct error_policy {
+
+  static constexpr size_t default_capacity{8};
+
+  size_t capacity{0};
+  bool fail_fast{false};
+
+};
+
+struct stats_policy {
+
+  bool enabled{false};
+
+};
+
+// Counters of a parser with stats_policy{.enabled = true}. parse_latency[k] counts parses that took 
+// less than 64 << k nanoseconds (the last bucket is open-ended), errors counts stored errors by code.
+template <size_t option_count>
+struct parse_stats {
+
+  static constexpr size_t latency_buckets{16};
+  static constexpr size_t error_codes{static_cast<size_t>(error_code::unknown_command) + 1};
+
+  std::array<std::uint64_t, option_count> gets{};
+  std::array<std::uint64_t, latency_buckets> parse_latency{};
+  std::array<std::uint64_t, error_codes> errors{};
+  std::uint64_t parses{0};
+  std::uint64_t failed_parses{0};
+
+};
+
+// Relaxed atomic counters behind parse_stats; readers see each counter exactly, but not a consistent 
+// set of counters while parses are running.
+template <size_t option_count>
+class stats_counters {
+
+  using stats_t = parse_stats<option_count>;
+
+public:
+
+  auto record_get(size_t idx) noexcept -> void { gets[idx].fetch_add(1, std::memory_order_relaxed); }
+
+  auto record_parse(std::chrono::nanoseconds latency, auto const& result_errors) noexcept -> void {
+    auto const nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    auto const bucket = std::min<size_t>(std::bit_width(nanoseconds >> 6), stats_t::latency_buckets - 1);
+    parse_latency[bucket].fetch_add(1, std::memory_order_relaxed);
+    parses.fetch_add(1, std::memory_order_relaxed);
+    if (result_errors.empty()) { return; }
+    failed_parses.fetch_add(1, std::memory_order_relaxed);
+    for (auto const& error_info : result_errors) {
+      errors[static_cast<size_t>(error_info.code)].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  auto load() const noexcept -> stats_t {
+    stats_t stats{};
+    auto const load_all = [](auto const& counters, auto& values) {
+      rng::transform(counters, values.begin(), [](auto const& counter) { 
+        return counter.load(std::memory_order_relaxed); 
+      });
+    };
+    load_all(gets, stats.gets);
+    load_all(parse_latency, stats.parse_latency);
+    load_all(errors, stats.errors);
+    stats.parses = parses.load(std::memory_order_relaxed);
+    stats.failed_parses = failed_parses.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  auto reset() noexcept -> void {
+    auto const reset_all = [](auto& counters) { 
+      for (auto& counter : counters) { counter.store(0, std::memory_order_relaxed); } 
+    };
+    reset_all(gets);
+    reset_all(parse_latency);
+    reset_all(errors);
+    parses.store(0, std::memory_order_relaxed);
+    failed_parses.store(0, std::memory_order_relaxed);
+  }
+
+private:
+
+  std::array<std::atomic<std::uint64_t>, option_count> gets{};
+  std::array<std::atomic<std::uint64_t>, stats_t::latency_buckets> parse_latency{};
+  std::array<std::atomic<std::uint64_t>, stats_t::error_codes> errors{};
+  std::atomic<std::uint64_t> parses{0};
+  std::atomic<std::uint64_t> failed_parses{0};
+
+};
+
+// Error records and the names their indices refer to: the option names of the parser, followed by the 
+// allowed values and command names that suggestions point at.
+template <size_t max_size>
+struct parse_errors {    
+
+  constexpr auto begin() const noexcept { return data.begin(); }
+  constexpr auto end() const noexcept { return std::next(begin(), right_size); }
+
+  constexpr auto empty() const noexcept -> bool { return count() == 0; }
+  constexpr auto count() const noexcept -> size_t { return right_size + dropped; }
+
+  constexpr auto append(parse_error_info const& error_info) noexcept -> parse_errors& {
+    if (right_size == max_size) { ++dropped; } 
+    else { data[right_size++] = error_info; }
+    return *this;
+  }
+
+  constexpr auto clear() noexcept -> void {
+    right_size = 0;
+    dropped = 0;
+  }
+
+  constexpr auto option_name(parse_error_info const& error_info) const noexcept -> std::string_view {
+    return error_info.option == parse_error_info::none ? std::string_view{} : names[error_info.option];
+  }
+
+  constexpr auto suggestion(parse_error_info const& error_info) const noexcept -> std::string_view {
+    return error_info.suggestion == parse_error_info::none ? std::string_view{} : names[error_info.suggestion];
+  }
+
+  std::array<parse_error_info, max_size> data{};
+  size_t right_size{0};
+  size_t dropped{0};
+  std::span<std::string_view const> names{};
+
+  friend auto operator<<(std::ostream& os, parse_errors const& errors) noexcept -> std::ostream& {
+    os << "Errors:\n";
+    for (auto const& error_info : errors) {
+      if (error_info.argument == parse_error_info::environment) { os << "  environment"; }
+      else { os << "  argument " << error_info.argument; }
+      auto const option_name = errors.option_name(error_info);
+      auto const suggestion = errors.suggestion(error_info);
+      if (!option_name.empty()) { os << " (--" << option_name << ')'; }
+      os << ", " << error_info.code;
+      if (!suggestion.empty() && error_info.code == error_code::unknown_command) {
+        os << ", did you mean " << suggestion << '?';
+      } else if (!suggestion.empty() && option_name.empty()) { 
+        os << ", did you mean --" << suggestion << '?'; 
+      } else if (!suggestion.empty()) {
+        os << ", did you mean --" << option_name << '=' << suggestion << '?'; 
+      }
+      os << '\n';
+    }
+    if (errors.dropped != 0) { os << "  ... and " << errors.dropped << " more\n"; }
+    return os;
+  }
+    
+};
+
+template <size_t max_size>
+constexpr auto edit_distance(std::string_view input, std::string_view candidate) noexcept -> size_t {
+  std::array<size_t, max_size + 1> row{};
+  rng::copy(std::views::iota(size_t{0}, candidate.size() + 1), rng::begin(row));
+  for (auto const c : input) {
+    auto diagonal = row[0]++;
+    for (auto const pos : std::views::iota(size_t{0}, candidate.size())) {
+      auto const above = row[pos + 1];
+      row[pos + 1] = std::min({above + 1, row[pos] + 1, diagonal + (c != candidate[pos])});
+      diagonal = above;
+    }
+  }
+  return row[candidate.size()];
+}
+
+// Position of the candidate closest to input, if it differs in at most a third of input's characters 
+// (rounded up).
+template <size_t max_size>
+constexpr auto nearest_candidate(std::string_view input, rng::forward_range auto&& candidates) noexcept 
+-> std::optional<size_t> {
+  std::optional<size_t> result{};
+  auto best = (input.size() + 2) / 3 + 1;
+  size_t position{0};
+  for (std::string_view candidate : candidates) {
+    if (auto const distance = edit_distance<max_size>(input, candidate); distance < best) { 
+      best = distance; 
+      result = position; 
+    }
+    ++position;
+  }
+  return result;
+}
+
+template <typename value_t, size_t max_count>
+struct repeated_values {
+
+  constexpr auto append(value_t const& value) noexcept -> bool {
+    if (count == max_count) { return false; }
+    data[count++] = value;
+    return true;
+  }
+
+  constexpr auto back() const noexcept -> value_t const& { return data[count - 1]; }
+
+  constexpr auto span() const noexcept -> std::span<value_t const> { return {data.data(), count}; }
+
+  std::array<value_t, max_count> data{};
+  size_t count{0};
+
+};
+
+// Slot types of non-repeated options, widest first.
+using compact_slot_types = std::tuple<std::string_view, double, long long, std::int32_t, std::uint32_t, 
+                                      std::int16_t, std::uint16_t, std::int8_t, std::uint8_t>;
+
+template <typename int_t>
+constexpr auto holds_range(option const& opt) noexcept -> bool {
+  return std::in_range<int_t>(opt.integral_min) && std::in_range<int_t>(opt.integral_max);
+}
+
+// A non-repeated option with allowed values stores the position of its value in the value table, a ranged 
+// integral option its value in the narrowest integer type of the range.
+constexpr auto compact_slot_kind(option const& opt) noexcept -> size_t {
+  if (!opt.ranged) { return opt.allowed_count <= 256 ? 8 : 6; }
+  if (opt.value == option::string) { return 0; }
+  if (opt.value == option::floating_point) { return 1; }
+  if (holds_range<std::uint8_t>(opt)) { return 8; }
+  if (holds_range<std::int8_t>(opt)) { return 7; }
+  if (holds_range<std::uint16_t>(opt)) { return 6; }
+  if (holds_range<std::int16_t>(opt)) { return 5; }
+  if (holds_range<std::uint32_t>(opt)) { return 4; }
+  if (holds_range<std::int32_t>(opt)) { return 3; }
+  return 2;
+}
+
+// Values of parser_result_t as a structure of arrays: one array per compact slot type, indexed by the 
+// position of the option among the options of that type, and preallocated storage for repeated options.
+template <auto opts>
+class option_slots {
+
+  static constexpr size_t repeated_kind{std::tuple_size_v<compact_slot_types>};
+
+  static constexpr auto kinds = [] {
+    std::array<size_t, opts.size> result{};
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) {
+      result[idx] = opts.data[idx].max_count != 0 ? repeated_kind : compact_slot_kind(opts.data[idx]);
+    }
+    return result;
+  }();
+
+  static constexpr auto kind_sizes = [] {
+    std::array<size_t, repeated_kind + 1> result{};
+    for (auto const kind : kinds) { ++result[kind]; }
+    return result;
+  }();
+
+  static constexpr auto positions = [] {
+    std::array<size_t, opts.size> result{};
+    std::array<size_t, repeated_kind + 1> seen{};
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) { result[idx] = seen[kinds[idx]]++; }
+    return result;
+  }();
+
+  static constexpr auto repeated_options = [] {
+    std::array<size_t, kind_sizes[repeated_kind]> result{};
+    rng::copy_if(std::views::iota(size_t{0}, opts.size), rng::begin(result), 
+                 [](auto idx) { return kinds[idx] == repeated_kind; });
+    return result;
+  }();
+
+  template <size_t idx>
+  using repeated_slot_t = repeated_values<option_storage_t<opts.data[idx].value>, opts.data[idx].max_count>;
+
+  template <size_t... kind>
+  static auto make_compact(std::index_sequence<kind...>) 
+  -> std::tuple<std::array<std::tuple_element_t<kind, compact_slot_types>, kind_sizes[kind]>...>;
+
+  template <size_t... position>
+  static auto make_repeated(std::index_sequence<position...>) 
+  -> std::tuple<repeated_slot_t<repeated_options[position]>...>;
+
+public:
+
+  template <size_t idx>
+  using slot_t = std::conditional_t<kinds[idx] == repeated_kind, repeated_slot_t<idx>, 
+                                    std::tuple_element_t<std::min(kinds[idx], repeated_kind - 1), compact_slot_types>>;
+
+  template <size_t idx>
+  constexpr auto get() noexcept -> slot_t<idx>& {
+    if constexpr (kinds[idx] == repeated_kind) { return std::get<positions[idx]>(repeated); } 
+    else { return std::get<kinds[idx]>(compact)[positions[idx]]; }
+  }
+
+  template <size_t idx>
+  constexpr auto get() const noexcept -> slot_t<idx> const& {
+    if constexpr (kinds[idx] == repeated_kind) { return std::get<positions[idx]>(repeated); } 
+    else { return std::get<kinds[idx]>(compact)[positions[idx]]; }
+  }
+
+  // Empties the storage of repeated options and marks them as not present.
+  constexpr auto clear_repeated(auto& present) noexcept -> void {
+    std::apply([](auto&... slots) { ((slots.count = 0), ...); }, repeated);
+    for (auto const idx : repeated_options) { present.reset(idx); }
+  }
+
+private:
+
+  decltype(make_compact(std::make_index_sequence<repeated_kind>{})) compact{};
+  decltype(make_repeated(std::make_index_sequence<repeated_options.size()>{})) repeated{};
+
+};
+
+constexpr auto hash_name(std::string_view name) noexcept -> std::uint64_t {
+  std::uint64_t hash{0xcbf29ce484222325};
+  for (auto c : name) { hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3; }
+  return hash;
+}
+
+constexpr auto mix_hash(std::uint64_t hash, std::uint64_t seed) noexcept -> std::uint64_t {
+  hash ^= seed * 0x9e3779b97f4a7c15;
+  hash ^= hash >> 33; hash *= 0xff51afd7ed558ccd;
+  hash ^= hash >> 33; hash *= 0xc4ceb9fe1a85ec53;
+  return hash ^ (hash >> 33);
+}
+
+template <size_t max_value>
+using narrow_index_t = std::conditional_t<max_value <= std::numeric_limits<std::uint16_t>::max(), 
+                                          std::uint16_t, std::uint32_t>;
+
+template <size_t key_count, size_t pool_size>
+struct perfect_hash {
+
+  static constexpr size_t bucket_count{key_count / 2 + 1};
+  static constexpr size_t slot_count{std::bit_ceil(2 * key_count + 1)};
+  static constexpr std::uint64_t max_seed{1 << 16};
+
+  using offset_t = narrow_index_t<pool_size>;
+  using slot_t = narrow_index_t<key_count>;
+
+  constexpr perfect_hash(std::array<std::string_view, key_count> const& names) noexcept {
+    for (auto key : std::views::iota(size_t{0}, key_count)) {
+      rng::copy(names[key], std::next(rng::begin(pool), offsets[key]));
+      offsets[key + 1] = static_cast<offset_t>(offsets[key] + names[key].size());
+    }
+    slots.fill(key_count);
+    std::array<std::uint64_t, key_count> hashes{};
+    std::array<size_t, bucket_count + 1> bucket_start{};
+    for (auto key : std::views::iota(size_t{0}, key_count)) {
+      hashes[key] = hash_name(key_name(key));
+      ++bucket_start[bucket_of(hashes[key]) + 1];
+    }
+    for (auto bucket : std::views::iota(size_t{0}, bucket_count)) {
+      bucket_start[bucket + 1] += bucket_start[bucket];
+    }
+
+    std::array<size_t, key_count> members{};
+    auto next_member = bucket_start;
+    for (auto key : std::views::iota(size_t{0}, key_count)) {
+      members[next_member[bucket_of(hashes[key])]++] = key;
+    }
+
+    std::array<size_t, bucket_count> order{};
+    rng::copy(std::views::iota(size_t{0}, bucket_count), rng::begin(order));
+    rng::sort(order, rng::greater{}, [&](auto bucket) { 
+      return bucket_start[bucket + 1] - bucket_start[bucket]; });
+
+    std::array<size_t, key_count> candidates{};
+    for (auto bucket : order) {
+      auto const bucket_keys = rng::subrange{std::next(rng::begin(members), bucket_start[bucket]), 
+                                             std::next(rng::begin(members), bucket_start[bucket + 1])};
+      if (bucket_keys.empty()) { break; }
+      if (!place(bucket, bucket_keys, hashes, candidates)) { valid = false; return; }
+    }
+  }
+
+  constexpr auto find(std::string_view name) const noexcept -> size_t {
+    auto const hash = hash_name(name);
+    auto const seed = seeds[bucket_of(hash)];
+    size_t const key = slots[mix_hash(hash, seed) & (slot_count - 1)];
+    return key != key_count && key_name(key) == name ? key : key_count;
+  }
+
+  constexpr auto key_name(size_t key) const noexcept -> std::string_view {
+    return {std::next(pool.data(), offsets[key]), static_cast<size_t>(offsets[key + 1] - offsets[key])};
+  }
+
+  std::array<char, pool_size> pool{};
+  std::array<offset_t, key_count + 1> offsets{};
+  std::array<std::uint16_t, bucket_count> seeds{};
+  std::array<slot_t, slot_count> slots{};
+  bool valid{true};
+
+private:
+
+  static constexpr auto bucket_of(std::uint64_t hash) noexcept -> size_t {
+    return mix_hash(hash, 0) % bucket_count;
+  }
+
+  constexpr auto place(size_t bucket, auto const& bucket_keys, 
+                       std::array<std::uint64_t, key_count> const& hashes,
+                       std::array<size_t, key_count>& candidates) noexcept -> bool {
+    for (auto const idx : std::views::iota(size_t{0}, rng::size(bucket_keys))) {
+      auto const rest = bucket_keys | std::views::drop(idx + 1);
+      if (rng::any_of(rest, [&](auto other) { return key_name(other) == key_name(bucket_keys[idx]); })) { 
+        return false; 
+      }
+    }
+    for (auto seed : std::views::iota(std::uint64_t{1}, max_seed)) {
+      size_t placed{0};
+      for (auto key : bucket_keys) {
+        auto const slot = mix_hash(hashes[key], seed) & (slot_count - 1);
+        auto const taken = rng::subrange{rng::begin(candidates), std::next(rng::begin(candidates), placed)};
+        if (slots[slot] != key_count || rng::find(taken, slot) != rng::end(taken)) { break; }
+        candidates[placed++] = slot;
+      }
+      if (placed != rng::size(bucket_keys)) { continue; }
+      for (auto const idx : std::views::iota(size_t{0}, placed)) { 
+        slots[candidates[idx]] = static_cast<slot_t>(bucket_keys[idx]); 
+      }
+      seeds[bucket] = static_cast<std::uint16_t>(seed);
+      return true;
+    }
+    return false;
+  }
+
+};
+
+template <size_t node_capacity>
+struct value_trie {
+
+  using index_t = narrow_index_t<node_capacity>;
+
+  static constexpr index_t no_value{node_capacity};
+
+  struct node {
+    index_t first_edge{};
+    index_t edge_count{};
+    index_t value{no_value};
+  };
+
+  struct edge {
+    unsigned char label{};
+    index_t target{};
+  };
+
+  constexpr value_trie(std::span<std::string_view const> values) noexcept {
+    std::array<size_t, node_capacity> order{};
+    auto const sorted = rng::subrange{rng::begin(order), std::next(rng::begin(order), values.size())};
+    rng::copy(std::views::iota(size_t{0}, values.size()), rng::begin(sorted));
+    rng::sort(sorted, {}, [&](auto value) { return values[value]; });
+
+    struct work_item { size_t node, first, last, depth; };
+    std::array<work_item, node_capacity> queue{};
+    size_t head{0}, tail{0};
+    queue[tail++] = {0, 0, values.size(), 0};
+    node_count = 1;
+
+    while (head != tail) {
+      auto [current, first, last, depth] = queue[head++];
+      if (first != last && values[order[first]].size() == depth) { 
+        nodes[current].value = static_cast<index_t>(order[first++]); 
+      }
+
+      nodes[current].first_edge = static_cast<index_t>(edge_count);
+      while (first != last) {
+        auto const label = label_at(values[order[first]], depth);
+        auto group_last = first;
+        while (group_last != last && label_at(values[order[group_last]], depth) == label) { ++group_last; }
+        edges[edge_count++] = {label, static_cast<index_t>(node_count)};
+        queue[tail++] = {node_count++, first, group_last, depth + 1};
+        first = group_last;
+      }
+      nodes[current].edge_count = static_cast<index_t>(edge_count - nodes[current].first_edge);
+    }
+  }
+
+  constexpr auto find(std::string_view str) const noexcept -> std::optional<size_t> {
+    size_t current{0};
+    for (auto c : str) {
+      auto const first = std::next(rng::begin(edges), nodes[current].first_edge);
+      auto const last = std::next(first, nodes[current].edge_count);
+      auto const label = static_cast<unsigned char>(c);
+      auto const pos = rng::lower_bound(first, last, label, {}, &edge::label);
+      if (pos == last || pos->label != label) { return std::nullopt; }
+      current = pos->target;
+    }
+    if (nodes[current].value == no_value) { return std::nullopt; }
+    return size_t{nodes[current].value};
+  }
+
+  std::array<node, node_capacity> nodes{};
+  std::array<edge, node_capacity> edges{};
+  size_t node_count{0};
+  size_t edge_count{0};
+
+private:
+
+  static constexpr auto label_at(std::string_view value, size_t depth) noexcept -> unsigned char {
+    return static_cast<unsigned char>(value[depth]);
+  }
+
+};
+
+constexpr auto trim_whitespace(std::string_view str) noexcept -> std::string_view {
+  constexpr std::string_view whitespace{" \t\n\v\f\r"};
+  auto const first = str.find_first_not_of(whitespace);
+  if (first == std::string_view::npos) { return {}; }
+  return str.substr(first, str.find_last_not_of(whitespace) - first + 1);
+}
+
+constexpr auto next_token(std::string_view& rest) noexcept -> std::string_view {
+  constexpr std::string_view whitespace{" \t\n\v\f\r"};
+  auto const first = std::min(rest.find_first_not_of(whitespace), rest.size());
+  rest.remove_prefix(first);
+  auto const token = rest.substr(0, std::min(rest.find_first_of(whitespace), rest.size()));
+  rest.remove_prefix(token.size());
+  return token;
+}
+
+template <literal_string opt_name, auto opt_member>
+struct bind {
+
+  static constexpr auto name = opt_name.to_view_remove_suffix();
+  static constexpr auto member = opt_member;
+
+};
+
+template <typename member_ptr_t>
+struct member_type;
+
+template <typename class_t, typename value_t>
+struct member_type<value_t class_t::*> { 
+  using type = value_t; 
+  using class_type = class_t;
+};
+
+template <typename member_ptr_t>
+struct member_type<member_ptr_t const> : member_type<member_ptr_t> {};
+
+template <options global_opts, typename... commands_t>
+class commands;
+
+template <options opts, size_t max_token_size>
+class stream_parser;
+
+template <options opts, error_policy policy = error_policy{}, stats_policy statistics = stats_policy{}>
+class batch_parser;
+
+template <options opts, error_policy policy = error_policy{}, stats_policy statistics = stats_policy{}>
+class parser {
+public:    
+
+  static constexpr size_t error_capacity{policy.capacity == 0 ? error_policy::default_capacity : policy.capacity};
+    
+  class parser_result_t {
+  public:
+
+    template <options, error_policy, stats_policy> friend class parser;
+    template <options, size_t> friend class stream_parser;
+    template <options, error_policy, stats_policy> friend class batch_parser;
+        
+    constexpr operator bool() const noexcept { return errors.empty(); }
+
+    template <literal_string opt, typename opt_type>
+    constexpr auto get() const noexcept -> std::pair<std::optional<opt_type>, 
+                                                     std::optional<error_code>> {        
+      constexpr auto idx = name_index.find(opt.to_view_remove_suffix());
+      if constexpr (idx == opts.size) { 
+        return {{}, error_code::option_not_found}; 
+      } else {
+        record_get(idx);
+        constexpr auto opt_kind = opts.data[idx].value;
+        if (present[idx]) { 
+          if constexpr (opts.data[idx].max_count != 0) { 
+            return convert_value<opt_type, opt_kind>(values.template get<idx>().back()); 
+          } else {
+            return convert_value<opt_type, opt_kind>(stored_value<idx>()); 
+          }
+        }
+
+        if constexpr (std::string_view{opts.data[idx].defval}.empty()) {
+          return {{}, error_code::option_not_found};
+        } else {
+          return converted_defaults<opt_type, idx>;
+        }
+      }
+    }
+
+    template <literal_string opt, typename opt_type>
+    constexpr auto get_all() const noexcept -> std::pair<std::optional<std::span<opt_type const>>, 
+                                                         std::optional<error_code>> {        
+      constexpr auto idx = name_index.find(opt.to_view_remove_suffix());
+      if constexpr (idx == opts.size) { 
+        return {{}, error_code::option_not_found}; 
+      } else if constexpr (!std::is_same_v<opt_type, option_storage_t<opts.data[idx].value>> || narrowed<idx>) {
+        return {{}, error_code::incorrect_type}; 
+      } else {
+        record_get(idx);
+        if (present[idx]) {
+          if constexpr (opts.data[idx].max_count != 0) { 
+            return {values.template get<idx>().span(), {}}; 
+          } else if constexpr (!opts.data[idx].ranged) {
+            return {std::span{&std::get<idx>(value_tables)[values.template get<idx>()], 1}, {}}; 
+          } else {
+            return {std::span{&values.template get<idx>(), 1}, {}}; 
+          }
+        }
+        if constexpr (std::string_view{opts.data[idx].defval}.empty()) {
+          return {{}, error_code::option_not_found};
+        } else {
+          return {std::span{default_values<idx>}, {}};
+        }
+      }
+    }
+
+    parse_errors<error_capacity> errors{.names = error_names};
+
+  private:
+
+    constexpr parser_result_t() = default;
+
+    constexpr auto reset() noexcept -> void {
+      values.clear_repeated(present);
+      present.reset();
+      errors.clear();
+    }
+
+    // Ranged integral options without repeat<N> are stored in the narrowest integer type of their range, 
+    // so get_all has no span of long long to return for them.
+    template <size_t idx>
+    static constexpr bool narrowed{opts.data[idx].max_count == 0 && opts.data[idx].ranged && 
+                                   opts.data[idx].value == option::integral && 
+                                   !std::is_same_v<typename option_slots<opts>::template slot_t<idx>, long long>};
+
+    template <size_t idx>
+    constexpr auto stored_value() const noexcept -> option_storage_t<opts.data[idx].value> {
+      if constexpr (opts.data[idx].ranged) { return values.template get<idx>(); } 
+      else { return std::get<idx>(value_tables)[values.template get<idx>()]; }
+    }
+        
+    template <typename opt_type, option::type opt_kind>
+    static constexpr auto convert_value(option_storage_t<opt_kind> const& value) noexcept
+    -> std::pair<std::optional<opt_type>, std::optional<error_code>> {        
+      if constexpr (std::integral<opt_type>) {
+        if constexpr (opt_kind != option::integral) { return {{}, error_code::incorrect_type}; }
+        else if constexpr (std::is_same_v<opt_type, bool>) { return {value != 0, {}}; }
+        else if (!std::in_range<opt_type>(value)) { return {{}, error_code::out_of_range}; }
+        else { return {static_cast<opt_type>(value), {}}; }
+      } else if constexpr (std::is_same_v<opt_type, std::string_view>) { 
+        if constexpr (opt_kind != option::string) { return {{}, error_code::incorrect_type}; }
+        else { return {value, {}}; }
+      } else if constexpr (std::floating_point<opt_type>) { 
+        if constexpr (opt_kind != option::floating_point) { 
+          return {{}, error_code::incorrect_type}; 
+        } else {
+          // Values are stored as correctly rounded doubles, so a narrower opt_type is rounded a second time.
+          if constexpr (std::numeric_limits<opt_type>::max() < std::numeric_limits<double>::max()) {
+            constexpr auto max = static_cast<double>(std::numeric_limits<opt_type>::max());
+            constexpr auto infinity = std::numeric_limits<double>::infinity();
+            if ((max < value && value < infinity) || (-infinity < value && value < -max)) { 
+              return {{}, error_code::out_of_range}; 
+            }
+          }
+          return {static_cast<opt_type>(value), {}};
+        }
+      } else {
+        return {{}, error_code::unknown_type};
+      }
+    }
+        
+    option_slots<opts> values{};
+    std::bitset<opts.size> present{};
+
+  };
+
+  // Result of try_parse_into: options bound with ctclp::bind are converted straight into the members of 
+  // config, which starts from a compile-time image of the default values.
+  template <typename config_t, typename... binds_t>
+  class config_result_t {
+  public:
+
+    template <options, error_policy, stats_policy> friend class parser;
+
+    constexpr operator bool() const noexcept { return errors.empty(); }
+
+    config_t config{default_image<config_t, binds_t...>};
+    parse_errors<error_capacity> errors{.names = error_names};
+
+  private:
+
+    constexpr config_result_t() = default;
+
+    std::bitset<opts.size> present{};
+
+  };
+
+  template <size_t argc, auto argv>
+  static constexpr auto try_parse() noexcept -> parser_result_t {
+    return try_parse(static_cast<int>(argc), argv);
+  }
+
+  template <size_t argc>
+  static constexpr auto try_parse(char const* (&argv)[argc]) noexcept -> parser_result_t {
+    return try_parse(static_cast<int>(argc), argv);
+  }
+
+  static constexpr auto try_parse(int argc, char const* const* argv) noexcept -> parser_result_t {
+    auto const arguments = std::span{argv, static_cast<size_t>(std::max(argc, 0))};
+    return measured([&] { return parser{}.parse(arguments | std::views::drop(1)); });
+  }
+
+  template <typename config_t, typename... binds_t>
+  static constexpr auto try_parse_into(int argc, char const* const* argv) noexcept 
+  -> config_result_t<config_t, binds_t...> {
+    static_assert(((name_index.find(binds_t::name) != opts.size) && ...), "Bound option is not configured.");
+    static_assert((std::is_same_v<typename member_type<decltype(binds_t::member)>::class_type, config_t> && ...), 
+                  "Bound members must belong to the configuration struct.");
+    static_assert(((opts.data[name_index.find(binds_t::name)].max_count == 0) && ...), 
+                  "Repeated options cannot be bound to a member.");
+    static_assert((bind_converts<binds_t>() && ...), "Bound members must have a type the option converts to.");
+    static_assert((bind_default_fits<binds_t>() && ...), "Default value does not fit the bound member.");
+    static_assert([] {
+      std::array<std::string_view, sizeof...(binds_t)> names{binds_t::name...};
+      rng::sort(names);
+      return rng::adjacent_find(names) == rng::end(names);
+    }(), "An option can only be bound once.");
+    auto const arguments = std::span{argv, static_cast<size_t>(std::max(argc, 0))};
+    return measured([&] {
+      config_result_t<config_t, binds_t...> result{};
+      parser{}.parse_arguments(arguments | std::views::drop(1), result);
+      if !consteval { 
+        if (!stop(result)) { parser{}.parse_environment(result); } 
+      }
+      return result;
+    });
+  }
+
+  // Reads @path arguments through files, e.g. ctclp::response_files from ctclp_response_files.hpp, which 
+  // must outlive the result.
+  static auto try_parse(int argc, char const* const* argv, auto& files) noexcept -> parser_result_t {
+    auto const arguments = std::span{argv, static_cast<size_t>(std::max(argc, 0))};
+    return measured([&] { return parser{}.parse(arguments | std::views::drop(1), files); });
+  }
+
+  static auto stats() noexcept -> parse_stats<opts.size> requires (statistics.enabled) { return counters.load(); }
+
+  static auto reset_stats() noexcept -> void requires (statistics.enabled) { counters.reset(); }
+
+private:
+
+  template <options, typename...> friend class commands;
+  template <options, size_t> friend class stream_parser;
+  template <options, error_policy, stats_policy> friend class batch_parser;
+    
+  constexpr parser() = default;
+
+  constexpr auto parse(rng::input_range auto&& arguments, std::uint32_t first_position = 0) const noexcept 
+  -> parser_result_t {
+    parser_result_t result{};
+    parse_arguments(arguments, result, first_position);
+    if !consteval { 
+      if (!stop(result)) { parse_environment(result); } 
+    }
+    return result;
+  }
+
+  constexpr auto parse_arguments(rng::input_range auto&& arguments, auto& result, 
+                                 std::uint32_t first_position = 0) const noexcept -> void {
+    argument_state state{.position = first_position};
+    for (std::string_view argument : arguments) { 
+      parse_argument(argument, state, result); 
+      if (stop(result)) { return; }
+    }
+    finish_arguments(state, result);
+  }
+
+  // Parses options up to the first argument that is neither an option nor its value and returns 
+  // the number of arguments consumed.
+  constexpr auto parse_prefix(std::span<char const* const> arguments) const noexcept 
+  -> std::pair<parser_result_t, size_t> {
+    parser_result_t result{};
+    argument_state state{};
+    size_t consumed{0};
+    for (std::string_view argument : arguments) { 
+      if (state.pending == opts.size && !trim_whitespace(argument).starts_with('-')) { break; }
+      parse_argument(argument, state, result); 
+      ++consumed;
+    }
+    finish_arguments(state, result);
+    if !consteval { parse_environment(result); }
+    return {result, consumed};
+  }
+
+  // Errors in a response file are reported at the position of its @file argument.
+  auto parse(rng::input_range auto&& arguments, auto& files) const noexcept -> parser_result_t {
+    parser_result_t result{};
+    std::uint32_t file_position{0};
+    for (std::string_view argument : arguments) {
+      auto const position = file_position++;
+      if (!is_response_file(argument)) { continue; }
+      auto const contents = files.open(argument.data() + 1);
+      if (!contents) { 
+        result.errors.append(parse_error_info{position, parse_error_info::none, error_code::response_file_error}); 
+        if (stop(result)) { return result; }
+        continue; 
+      }
+      argument_state file_state{};
+      for (auto rest = *contents; !rest.empty();) {
+        file_state.position = position;
+        if (auto const token = next_token(rest); !token.empty()) { parse_argument(token, file_state, result); }
+        if (stop(result)) { return result; }
+      }
+      finish_arguments(file_state, result);
+    }
+    argument_state state{};
+    for (std::string_view argument : arguments) { 
+      if (is_response_file(argument)) { 
+        ++state.position; 
+        continue; 
+      }
+      parse_argument(argument, state, result); 
+      if (stop(result)) { return result; }
+    }
+    finish_arguments(state, result);
+    parse_environment(result);
+    return result;
+  }
+
+  static inline std::conditional_t<statistics.enabled, stats_counters<opts.size>, std::monostate> counters{};
+
+  // Without stats_policy{.enabled = true} both hooks are empty and parse_fn is called directly.
+  static constexpr auto measured(auto&& parse_fn) noexcept -> decltype(auto) {
+    if constexpr (statistics.enabled) {
+      if !consteval {
+        auto const started = std::chrono::steady_clock::now();
+        decltype(auto) result = parse_fn();
+        counters.record_parse(std::chrono::steady_clock::now() - started, result.errors);
+        return result;
+      }
+    }
+    return parse_fn();
+  }
+
+  static constexpr auto record_get(size_t idx) noexcept -> void {
+    if constexpr (statistics.enabled) {
+      if !consteval { counters.record_get(idx); }
+    }
+  }
+
+  static constexpr auto stop(auto const& result) noexcept -> bool {
+    return policy.fail_fast && !result;
+  }
+
+  static constexpr auto is_response_file(std::string_view argument) noexcept -> bool {
+    return argument.starts_with('@');
+  }
+
+  static constexpr auto has_env(size_t idx) noexcept -> bool { return *opts.data[idx].env != '\0'; }
+
+  struct env_option {
+    size_t idx;
+    char const* name;
+  };
+
+  static constexpr auto env_options = [] {
+    std::array<env_option, rng::count_if(std::views::iota(size_t{0}, opts.size), has_env)> result{};
+    auto out = rng::begin(result);
+    for (auto const idx : std::views::iota(size_t{0}, opts.size) | std::views::filter(has_env)) {
+      *out++ = env_option{idx, opts.data[idx].env};
+    }
+    return result;
+  }();
+
+  auto parse_environment(auto& result) const noexcept -> void {
+    for (auto const [idx, name] : env_options) {
+      if (result.present[idx]) { continue; }
+      auto const value = std::getenv(name);
+      if (value == nullptr) { continue; }
+      if (auto const ec = parsers_for(result)[idx](value, result)) {
+        result.errors.append(parse_error_info{parse_error_info::environment, static_cast<std::uint16_t>(idx), *ec, 
+                                              suggest_value(idx, *ec, value)});
+        if (stop(result)) { return; }
+      }
+    }
+  }
+
+  struct argument_state {
+    size_t pending{opts.size};
+    std::uint32_t pending_position{0};
+    std::uint32_t position{0};
+    size_t positional{0};
+    bool options_ended{false};
+  };
+
+  // Accepts --name=value, --name value, -n value, -nvalue, -n=value, switches with an implicit value, 
+  // positionals in declaration order and -- to end the options. A value that belongs to the previous 
+  // argument is carried in the state, so every argument is looked at once.
+  constexpr auto parse_argument(std::string_view input, argument_state& state, auto& result) const noexcept 
+  -> void {
+    auto const argument = trim_whitespace(input);
+    auto const position = state.position++;
+    if (state.pending != opts.size) {
+      return store_argument(std::exchange(state.pending, opts.size), argument, state.pending_position, result);
+    }
+
+    if (!state.options_ended && argument == "--") { 
+      state.options_ended = true; 
+      return; 
+    }
+
+    if (!state.options_ended && argument.starts_with("--")) {
+      auto const separator = argument.find('=');
+      auto const idx = name_index.find(argument.substr(2, separator - 2));
+      if (idx == opts.size) {
+        result.errors.append(parse_error_info{position, parse_error_info::none, error_code::parse_error, 
+                                              suggest_option(argument)});
+      } else if (separator != std::string_view::npos) {
+        store_argument(idx, argument.substr(separator + 1), position, result);
+      } else {
+        expect_value(idx, position, state, result);
+      }
+      return;
+    }
+
+    if (!state.options_ended && argument.size() > 1 && argument.starts_with('-')) {
+      size_t const idx = short_index[static_cast<unsigned char>(argument[1])];
+      if (idx != opts.size && argument.size() == 2) { return expect_value(idx, position, state, result); }
+      if (idx != opts.size) { return store_argument(idx, argument.substr(argument[2] == '=' ? 3 : 2), position, result); }
+      if (!is_digit(argument[1])) { 
+        result.errors.append(parse_error_info{position, parse_error_info::none, error_code::parse_error}); 
+        return;
+      }
+    }
+
+    if (state.positional == positional_options.size()) {
+      result.errors.append(parse_error_info{position, parse_error_info::none, error_code::parse_error});
+      return;
+    }
+    auto const idx = positional_options[state.positional];
+    if (!repeatable[idx]) { ++state.positional; }
+    store_argument(idx, argument, position, result);
+  }
+
+  constexpr auto expect_value(size_t idx, std::uint32_t position, argument_state& state, 
+                              auto& result) const noexcept -> void {
+    if (!implicit_values[idx].empty()) { return store_argument(idx, implicit_values[idx], position, result); }
+    state.pending = idx;
+    state.pending_position = position;
+  }
+
+  constexpr auto finish_arguments(argument_state const& state, auto& result) const noexcept -> void {
+    if (state.pending == opts.size) { return; }
+    result.errors.append(parse_error_info{state.pending_position, static_cast<std::uint16_t>(state.pending), 
+                                          error_code::missing_value});
+  }
+
+  constexpr auto store_argument(size_t idx, std::string_view value, std::uint32_t position, 
+                                auto& result) const noexcept -> void {
+    if (auto const ec = parsers_for(result)[idx](value, result)) {
+      result.errors.append(parse_error_info{position, static_cast<std::uint16_t>(idx), *ec, 
+                                            suggest_value(idx, *ec, value)});
+    }
+  }
+
+  static constexpr auto is_digit(char c) noexcept -> bool { return '0' <= c && c <= '9'; }
+
+  static constexpr auto positional_options = [] {
+    constexpr auto is_positional = [](size_t idx) { return opts.data[idx].positional; };
+    std::array<size_t, rng::count_if(std::views::iota(size_t{0}, opts.size), is_positional)> result{};
+    rng::copy_if(std::views::iota(size_t{0}, opts.size), rng::begin(result), is_positional);
+    return result;
+  }();
+
+  static constexpr auto short_index = [] {
+    using index_t = narrow_index_t<opts.size>;
+    std::array<index_t, 256> result{};
+    result.fill(static_cast<index_t>(opts.size));
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) {
+      if (opts.data[idx].short_name == '\0') { continue; }
+      result[static_cast<unsigned char>(opts.data[idx].short_name)] = static_cast<index_t>(idx);
+    }
+    return result;
+  }();
+
+  // The fields of option that parsing reads for a runtime index, so the hot path does not touch the 
+  // option records themselves.
+  static constexpr auto implicit_values = [] {
+    std::array<std::string_view, opts.size> result{};
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) { result[idx] = opts.data[idx].implicit; }
+    return result;
+  }();
+
+  static constexpr auto repeatable = [] {
+    std::array<bool, opts.size> result{};
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) { result[idx] = opts.data[idx].max_count != 0; }
+    return result;
+  }();
+
+  static_assert([] {
+    std::array<bool, 256> seen{};
+    for (auto const& opt : opts) {
+      if (opt.short_name == '\0') { continue; }
+      if (std::exchange(seen[static_cast<unsigned char>(opt.short_name)], true)) { return false; }
+    }
+    return true;
+  }(), "Short option names must be unique.");
+
+  static constexpr size_t max_candidate_size = [] {
+    size_t result{0};
+    for (auto const& opt : opts) {
+      result = std::max(result, std::string_view{opt.name}.size());
+      for (auto value : std::span{opt.allowed_values, opt.allowed_count}) { result = std::max(result, value.size()); }
+    }
+    return result;
+  }();
+
+  // first_value_name[idx] is the position of the first allowed value of option idx in error_names.
+  static constexpr auto first_value_name = [] {
+    std::array<size_t, opts.size + 1> result{};
+    result[0] = opts.size;
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) {
+      result[idx + 1] = result[idx] + opts.data[idx].allowed_count;
+    }
+    return result;
+  }();
+  static_assert(first_value_name[opts.size] < parse_error_info::none, 
+                "Too many option names and allowed values for error records.");
+
+  // Option names, then the allowed values of every option in declaration order.
+  static constexpr auto error_names = [] {
+    std::array<std::string_view, first_value_name[opts.size]> result{};
+    for (auto const idx : std::views::iota(size_t{0}, opts.size)) {
+      auto const& opt = opts.data[idx];
+      result[idx] = opt.name;
+      rng::copy(std::span{opt.allowed_values, opt.allowed_count}, std::next(rng::begin(result), first_value_name[idx]));
+    }
+    return result;
+  }();
+
+  static constexpr auto suggest_option(std::string_view input) noexcept -> std::uint16_t {
+    auto const argument = trim_whitespace(input);
+    if (!argument.starts_with("--")) { return parse_error_info::none; }
+    auto const name = argument.substr(2, argument.find('=') - 2);
+    if (name_index.find(name) != opts.size) { return parse_error_info::none; }
+    auto const nearest = nearest_candidate<max_candidate_size>(name, std::views::iota(size_t{0}, opts.size) 
+      | std::views::transform([](auto idx) { return name_index.key_name(idx); }));
+    return nearest ? static_cast<std::uint16_t>(*nearest) : parse_error_info::none;
+  }
+
+  static constexpr auto suggest_value(size_t idx, error_code ec, std::string_view value) noexcept 
+  -> std::uint16_t {
+    if (ec != error_code::parse_error) { return parse_error_info::none; }
+    auto const candidates = std::span{error_names}.subspan(first_value_name[idx], 
+                                                           first_value_name[idx + 1] - first_value_name[idx]);
+    auto const nearest = nearest_candidate<max_candidate_size>(trim_whitespace(value), candidates);
+    return nearest ? static_cast<std::uint16_t>(first_value_name[idx] + *nearest) : parse_error_info::none;
+  }
+
+  template <size_t idx>
+  static constexpr auto in_range(option_storage_t<opts.data[idx].value> value) noexcept -> bool {
+    constexpr auto opt = opts.data[idx];
+    if constexpr (opt.value == option::string) {
+      return true;
+    } else if constexpr (opt.value == option::integral) {
+      return opt.integral_min <= value && value <= opt.integral_max;
+    } else {
+      return opt.floating_min <= value && value <= opt.floating_max;
+    }
+  }
+
+  template <size_t idx>
+  static constexpr auto parse_value(std::string_view value, auto& result) noexcept -> std::optional<error_code> {
+    if constexpr (opts.data[idx].ranged) {
+      auto const converted = to_storage<opts.data[idx].value, opts.data[idx].format>(value);
+      if (!converted) { return error_code::conversion_error; }
+      if (!in_range<idx>(*converted)) { return error_code::out_of_range; }
+      return store_value<idx>(*converted, 0, result);
+    } else {
+      auto const value_index = std::get<idx>(value_tries).find(value);
+      if (!value_index) { return error_code::parse_error; }
+      return store_value<idx>(std::get<idx>(value_tables)[*value_index], *value_index, result);
+    }
+  }
+
+  // table_index is the position of value in the value table of an option with allowed values.
+  template <size_t idx>
+  static constexpr auto store_value(option_storage_t<opts.data[idx].value> const& value, size_t table_index, 
+                                    parser_result_t& result) noexcept -> std::optional<error_code> {
+    using slot_t = typename option_slots<opts>::template slot_t<idx>;
+    if constexpr (opts.data[idx].max_count != 0) {
+      if (!result.values.template get<idx>().append(value)) { return error_code::repeat_limit_exceeded; }
+    } else if constexpr (opts.data[idx].ranged) {
+      result.values.template get<idx>() = static_cast<slot_t>(value);
+    } else {
+      result.values.template get<idx>() = static_cast<slot_t>(table_index);
+    }
+    result.present.set(idx);
+    return std::nullopt;
+  }
+
+  template <size_t idx, typename config_t, typename... binds_t>
+  static constexpr auto store_value(option_storage_t<opts.data[idx].value> const& value, size_t, 
+                                    config_result_t<config_t, binds_t...>& result) noexcept 
+  -> std::optional<error_code> {
+    constexpr std::array<std::string_view, sizeof...(binds_t)> names{binds_t::name...};
+    constexpr auto bound = static_cast<size_t>(rng::find(names, opts.data[idx].name) - rng::begin(names));
+    if constexpr (bound != sizeof...(binds_t)) {
+      using bind_t = std::tuple_element_t<bound, std::tuple<binds_t...>>;
+      using member_t = typename member_type<decltype(bind_t::member)>::type;
+      auto const [converted, ec] = parser_result_t::template convert_value<member_t, opts.data[idx].value>(value);
+      if (ec) { return ec; }
+      result.config.*bind_t::member = *converted;
+    }
+    result.present.set(idx);
+    return std::nullopt;
+  }
+
+  template <typename result_t, size_t... idx>
+  static constexpr auto make_value_parsers(std::index_sequence<idx...>) noexcept {
+    using value_parser = std::optional<error_code> (*)(std::string_view, result_t&) noexcept;
+    return std::array<value_parser, opts.size>{&parse_value<idx, result_t>...};
+  }
+
+  template <typename result_t>
+  static constexpr auto value_parsers = make_value_parsers<result_t>(std::make_index_sequence<opts.size>{});
+
+  template <typename result_t>
+  static constexpr auto parsers_for(result_t const&) noexcept -> auto const& { return value_parsers<result_t>; }
+
+public:
+    
+  template <size_t idx>
+  static constexpr auto allowed_values() noexcept {
+    return std::span{opts.data[idx].allowed_values, opts.data[idx].allowed_count};
+  }
+
+  template <size_t idx>
+  static constexpr auto make_value_trie() noexcept {
+    constexpr auto node_capacity = [] {
+      size_t result{1};
+      for (auto value : allowed_values<idx>()) { result += value.size(); }
+      return result;
+    }();
+    return value_trie<node_capacity>{allowed_values<idx>()};
+  }
+
+  template <size_t idx>
+  static constexpr auto make_value_table() noexcept {
+    constexpr auto opt_kind = opts.data[idx].value;
+    std::array<option_storage_t<opt_kind>, opts.data[idx].allowed_count> result{};
+    rng::transform(allowed_values<idx>(), rng::begin(result), [](auto value) { 
+      return *to_storage<opt_kind>(value); });
+    return result;
+  }
+
+  template <size_t... idx>
+  static constexpr auto make_value_tries(std::index_sequence<idx...>) noexcept {
+    return std::make_tuple(make_value_trie<idx>()...);
+  }
+
+  template <size_t... idx>
+  static constexpr auto make_value_tables(std::index_sequence<idx...>) noexcept {
+    return std::make_tuple(make_value_table<idx>()...);
+  }
+
+  static constexpr auto value_tries = make_value_tries(std::make_index_sequence<opts.size>{});
+  static constexpr auto value_tables = make_value_tables(std::make_index_sequence<opts.size>{});
+
+  template <size_t idx>
+  static constexpr std::array default_values{
+    *to_storage<opts.data[idx].value, opts.data[idx].format>(std::string_view{opts.data[idx].defval})
+  };
+
+  template <size_t... idx>
+  static constexpr auto make_name_index(std::index_sequence<idx...>) noexcept {
+    constexpr auto pool_size = (std::string_view{opts.data[idx].name}.size() + ... + 0);
+    return perfect_hash<opts.size, pool_size>{{std::string_view{opts.data[idx].name}...}};
+  }
+
+  template <typename opt_type, size_t idx>
+  static constexpr auto converted_defaults = 
+    parser_result_t::template convert_value<opt_type, opts.data[idx].value>(default_values<idx>[0]);
+
+  static constexpr auto name_index = make_name_index(std::make_index_sequence<opts.size>{});
+  static_assert(name_index.valid, "Option names must be unique.");
+
+  template <typename bind_t>
+  static constexpr auto bind_converts() noexcept -> bool {
+    constexpr auto idx = name_index.find(bind_t::name);
+    if constexpr (idx == opts.size) { 
+      return true; 
+    } else {
+      using member_t = typename member_type<decltype(bind_t::member)>::type;
+      constexpr auto ec = parser_result_t::template convert_value<member_t, opts.data[idx].value>({}).second;
+      return ec != error_code::incorrect_type && ec != error_code::unknown_type;
+    }
+  }
+
+  template <typename bind_t>
+  static constexpr auto bind_default_fits() noexcept -> bool {
+    constexpr auto idx = name_index.find(bind_t::name);
+    if constexpr (idx == opts.size || !bind_converts<bind_t>() || std::string_view{opts.data[idx].defval}.empty()) {
+      return true;
+    } else {
+      using member_t = typename member_type<decltype(bind_t::member)>::type;
+      return !parser_result_t::template convert_value<member_t, opts.data[idx].value>(default_values<idx>[0]).second;
+    }
+  }
+
+  template <typename config_t, typename... binds_t>
+  static constexpr auto default_image = [] {
+    config_t config{};
+    ([&] {
+      constexpr auto idx = name_index.find(binds_t::name);
+      if constexpr (idx != opts.size && bind_default_fits<binds_t>() && bind_converts<binds_t>() && 
+                    !std::string_view{opts.data[idx].defval}.empty()) {
+        using member_t = typename member_type<decltype(binds_t::member)>::type;
+        config.*binds_t::member = *parser_result_t::template convert_value<member_t, opts.data[idx].value>(
+          default_values<idx>[0]).first;
+      }
+    }(), ...);
+    return config;
+  }();
+
+};
+
+template <literal_string command_name, options command_opts>
+struct command {
+
+  static constexpr auto name = command_name.to_view_remove_suffix();
+  static constexpr auto opts = command_opts;
+
+};
+
+// The first argument after the global options selects a command through a perfect hash of the command 
+// names; only the parser of that command sees the remaining arguments.
+template <options global_opts, typename... commands_t>
+class commands {
+
+  static constexpr auto command_index = 
+    perfect_hash<sizeof...(commands_t), (commands_t::name.size() + ... + 0)>{{commands_t::name...}};
+  static_assert(command_index.valid, "Command names must be unique.");
+
+public:
+
+  static_assert(sizeof...(commands_t) > 0, "At least one command is required.");
+  static_assert(rng::none_of(global_opts, &option::positional), "Global options cannot be positional.");
+
+  static constexpr size_t no_command{sizeof...(commands_t)};
+
+  using global_parser = parser<global_opts>;
+
+  template <literal_string name>
+  using command_parser = parser<std::tuple_element_t<command_index.find(name.to_view_remove_suffix()), 
+                                                     std::tuple<commands_t...>>::opts>;
+
+  class commands_result_t {
+  public:
+
+    template <options, typename...> friend class commands;
+
+    constexpr operator bool() const noexcept {
+      return global && std::visit([](auto const& result) -> bool { 
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(result)>, std::monostate>) { return true; }
+        else { return result; }
+      }, selected);
+    }
+
+    constexpr auto index() const noexcept -> size_t { 
+      return selected.index() == 0 ? no_command : selected.index() - 1; 
+    }
+
+    constexpr auto command() const noexcept -> std::string_view {
+      return index() == no_command ? std::string_view{} : command_index.key_name(index());
+    }
+
+    template <literal_string name>
+    constexpr auto get() const noexcept -> typename command_parser<name>::parser_result_t const* {
+      return std::get_if<command_index.find(name.to_view_remove_suffix()) + 1>(&selected);
+    }
+
+    typename global_parser::parser_result_t global;
+
+  private:
+
+    constexpr explicit commands_result_t(typename global_parser::parser_result_t const& global) noexcept 
+      : global{global} 
+    {}
+
+    std::variant<std::monostate, typename parser<commands_t::opts>::parser_result_t...> selected{};
+
+  };
+
+  template <size_t argc, auto argv>
+  static constexpr auto try_parse() noexcept -> commands_result_t {
+    return try_parse(static_cast<int>(argc), argv);
+  }
+
+  static constexpr auto try_parse(int argc, char const* const* argv) noexcept -> commands_result_t {
+    auto const arguments = std::span{argv, static_cast<size_t>(std::max(argc, 0))}.subspan(argc > 0);
+    auto const [global, consumed] = global_parser{}.parse_prefix(arguments);
+    commands_result_t result{global};
+    result.global.errors.names = error_names;
+    if (consumed == arguments.size()) { return result; }
+
+    std::string_view const name{arguments[consumed]};
+    auto const idx = command_index.find(name);
+    if (idx == no_command) {
+      auto const nearest = nearest_candidate<max_name_size>(name, std::array{commands_t::name...});
+      result.global.errors.append(parse_error_info{static_cast<std::uint32_t>(consumed), parse_error_info::none, 
+        error_code::unknown_command, 
+        nearest ? static_cast<std::uint16_t>(global_parser::error_names.size() + *nearest) : parse_error_info::none});
+      return result;
+    }
+    command_parsers[idx](arguments.subspan(consumed + 1), static_cast<std::uint32_t>(consumed + 1), result);
+    return result;
+  }
+
+private:
+
+  // Error positions of a command count from the first argument after the program name as well.
+  template <size_t idx>
+  static constexpr auto parse_command(std::span<char const* const> arguments, std::uint32_t first_position, 
+                                      commands_result_t& result) noexcept -> void {
+    using command_t = std::tuple_element_t<idx, std::tuple<commands_t...>>;
+    result.selected.template emplace<idx + 1>(parser<command_t::opts>{}.parse(arguments, first_position));
+  }
+
+  template <size_t... idx>
+  static constexpr auto make_command_parsers(std::index_sequence<idx...>) noexcept {
+    using command_parser_t = void (*)(std::span<char const* const>, std::uint32_t, commands_result_t&) noexcept;
+    return std::array<command_parser_t, sizeof...(idx)>{&parse_command<idx>...};
+  }
+
+  static constexpr auto command_parsers = make_command_parsers(std::index_sequence_for<commands_t...>{});
+
+  static constexpr size_t max_name_size{std::max({commands_t::name.size()...})};
+
+  // The global error names followed by the command names that unknown_command errors suggest.
+  static constexpr auto error_names = [] {
+    std::array<std::string_view, global_parser::error_names.size() + sizeof...(commands_t)> result{};
+    rng::copy(std::array{commands_t::name...}, rng::copy(global_parser::error_names, rng::begin(result)).out);
+    return result;
+  }();
+  static_assert(error_names.size() < parse_error_info::none, "Too many names for error records.");
+
+};
+
+// Consumes newline- or NUL-delimited arguments chunk by chunk and updates one result in place. Tokens 
+// are parsed directly from the chunk; only a token split across chunks is copied into the carry 
+// buffer. Error positions count the tokens since the last finish. Options keep their value until a later 
+// round sets them again, except repeated options, whose values are collected anew in each round.
+template <options opts, size_t max_token_size = 4096>
+class stream_parser {
+public:
+
+  static_assert(rng::none_of(opts, [](auto const& opt) { return opt.value == option::string && opt.ranged; }), 
+                "Streamed string options require allowed values, any_string values would refer to the input.");
+
+  using parser_result_t = typename parser<opts>::parser_result_t;
+
+  constexpr auto feed(std::string_view chunk) noexcept -> void {
+    begin_round();
+    constexpr std::string_view delimiters{"\n\0", 2};
+    while (!chunk.empty()) {
+      auto const end = std::min(chunk.find_first_of(delimiters), chunk.size());
+      if (end == chunk.size()) { return carry_over(chunk); }
+      auto const token = chunk.substr(0, end);
+      chunk.remove_prefix(end + 1);
+      if (carry_size == 0 && !discarding) { 
+        parse_token(token); 
+        continue; 
+      }
+      carry_over(token);
+      if (!discarding) { parse_token({carry.data(), carry_size}); }
+      carry_size = 0;
+      discarding = false;
+    }
+  }
+
+  // Repeated options keep the values of this round until the next feed starts a new one.
+  constexpr auto finish() noexcept -> parser_result_t const& {
+    begin_round();
+    if (carry_size != 0 && !discarding) { parse_token({carry.data(), carry_size}); }
+    carry_size = 0;
+    discarding = false;
+    parser<opts>{}.finish_arguments(state, live);
+    state = {};
+    finished = true;
+    return live;
+  }
+
+  constexpr auto result() const noexcept -> parser_result_t const& { return live; }
+
+  constexpr auto clear_errors() noexcept -> void { live.errors.clear(); }
+
+private:
+
+  constexpr auto begin_round() noexcept -> void {
+    if (std::exchange(finished, false)) { live.values.clear_repeated(live.present); }
+  }
+
+  constexpr auto parse_token(std::string_view token) noexcept -> void {
+    if (trim_whitespace(token).empty()) { ++state.position; }
+    else { parser<opts>{}.parse_argument(token, state, live); }
+  }
+
+  constexpr auto carry_over(std::string_view part) noexcept -> void {
+    if (discarding) { return; }
+    if (carry_size + part.size() > max_token_size) {
+      live.errors.append(parse_error_info{state.position++, parse_error_info::none, error_code::parse_error});
+      discarding = true;
+      return;
+    }
+    rng::copy(part, std::next(rng::begin(carry), carry_size));
+    carry_size += part.size();
+  }
+
+  parser_result_t live{};
+  typename parser<opts>::argument_state state{};
+  std::array<char, max_token_size> carry{};
+  size_t carry_size{0};
+  bool discarding{false};
+  bool finished{false};
+
+};
+
+template <size_t capacity>
+struct static_text {
+
+  constexpr auto append(std::string_view str) noexcept -> static_text& {
+    if constexpr (capacity != 0) { rng::copy(str, std::next(data.begin(), size)); }
+    size += str.size();
+    return *this;
+  }
+
+  constexpr auto append(char c) noexcept -> static_text& { return append(std::string_view{&c, 1}); }
+
+  constexpr auto append(long long value) noexcept -> static_text& {
+    auto magnitude = value < 0 ? 0ull - static_cast<unsigned long long>(value) 
+                               : static_cast<unsigned long long>(value);
+    std::array<char, 20> digits{};
+    auto first = digits.size();
+    do { digits[--first] = static_cast<char>('0' + magnitude % 10); } while ((magnitude /= 10) != 0);
+    if (value < 0) { append('-'); }
+    return append(std::string_view{digits.data() + first, digits.size() - first});
+  }
+
+  // Six fractional digits and a decimal exponent outside [1e-4, 1e15) are enough for range bounds.
+  constexpr auto append(double value) noexcept -> static_text& {
+    if (value < 0) { append('-'); value = -value; }
+    long long exponent{0};
+    if (value >= 1e15 || (value != 0 && value < 1e-4)) {
+      for (; value >= 10; value /= 10) { ++exponent; }
+      for (; value < 1; value *= 10) { --exponent; }
+    }
+
+    auto whole = static_cast<long long>(value);
+    auto fraction = static_cast<long long>((value - static_cast<double>(whole)) * 1e6 + 0.5);
+    if (fraction == 1'000'000) { ++whole; fraction = 0; }
+    append(whole);
+    if (fraction != 0) {
+      std::array<char, 6> digits{};
+      for (auto it = digits.rbegin(); it != digits.rend(); ++it, fraction /= 10) { 
+        *it = static_cast<char>('0' + fraction % 10); 
+      }
+      auto const fraction_view = std::string_view{digits.data(), digits.size()};
+      append('.').append(fraction_view.substr(0, fraction_view.find_last_not_of('0') + 1));
+    }
+    if (exponent != 0) { append('e').append(exponent); }
+    return *this;
+  }
+
+  constexpr auto view() const noexcept -> std::string_view { return {data.data(), size}; }
+
+  std::array<char, capacity> data{};
+  size_t size{0};
+
+};
+
+// Usage text, allowed-value lists and bash/zsh completion scripts for a configuration. Every text is 
+// written twice at compile time, once to count its size and once into an array of exactly that size, 
+// so printing --help is a single write of static data.
+template <literal_string program_name, options opts>
+class help {
+
+  template <auto write>
+  static constexpr auto make_text = [] {
+    constexpr auto size = [] { static_text<0> counter{}; write(counter); return counter.size; }();
+    static_text<size> text{};
+    write(text);
+    return text;
+  }();
+
+  static constexpr auto program = program_name.to_view_remove_suffix();
+
+  static constexpr auto name(size_t idx) noexcept -> std::string_view { return opts.data[idx].name; }
+  static constexpr auto short_flag(size_t idx) noexcept -> std::string_view { 
+    return {&opts.data[idx].short_name, opts.data[idx].short_name != '\0' ? 1u : 0u}; 
+  }
+  static constexpr auto is_switch(size_t idx) noexcept -> bool { return *opts.data[idx].implicit != '\0'; }
+
+  static constexpr auto is_full_range(option const& opt) noexcept -> bool {
+    if (opt.value == option::integral) {
+      return opt.integral_min == std::numeric_limits<long long>::min() && 
+             opt.integral_max == std::numeric_limits<long long>::max();
+    }
+    return opt.value == option::string || (opt.floating_min == std::numeric_limits<double>::lowest() && 
+                                           opt.floating_max == std::numeric_limits<double>::max());
+  }
+
+  static constexpr auto write_values(auto& out, size_t idx, std::string_view separator) noexcept -> void {
+    auto const& opt = opts.data[idx];
+    for (size_t value = 0; !opt.ranged && value < opt.allowed_count; ++value) {
+      out.append(value == 0 ? std::string_view{} : separator).append(opt.allowed_values[value]);
+    }
+  }
+
+  static constexpr auto write_header(auto& out, size_t idx) noexcept -> void {
+    if (!short_flag(idx).empty()) { out.append('-').append(short_flag(idx)).append(", "); }
+    out.append("--").append(name(idx)).append(is_switch(idx) ? "[=<value>]" : "=<value>");
+  }
+
+  static constexpr auto write_details(auto& out, size_t idx) noexcept -> void {
+    auto const& opt = opts.data[idx];
+    auto separator = std::string_view{};
+    auto const item = [&](std::string_view label) -> auto& { 
+      return out.append(std::exchange(separator, "; ")).append(label).append(": "); 
+    };
+
+    if (!opt.ranged) { write_values(item("values"), idx, "|"); }
+    if (opt.ranged && !is_full_range(opt) && opt.value == option::integral) {
+      item("range").append(opt.integral_min).append("..").append(opt.integral_max);
+    }
+    if (opt.ranged && !is_full_range(opt) && opt.value == option::floating_point) {
+      item("range").append(opt.floating_min).append("..").append(opt.floating_max);
+    }
+    if (*opt.defval != '\0') { item("default").append(std::string_view{opt.defval}); }
+    if (is_switch(idx)) { item("implicit").append(std::string_view{opt.implicit}); }
+    if (*opt.env != '\0') { item("env").append(std::string_view{opt.env}); }
+    if (opt.max_count != 0) { item("repeat").append(static_cast<long long>(opt.max_count)); }
+  }
+
+  static constexpr auto header_size(size_t idx) noexcept -> size_t {
+    static_text<0> counter{};
+    write_header(counter, idx);
+    return counter.size;
+  }
+
+  static constexpr size_t header_width = [] {
+    size_t width{0};
+    for (size_t idx = 0; idx < opts.size; ++idx) { width = std::max(width, header_size(idx)); }
+    return width;
+  }();
+
+  // Usage: program [options] <positional> [<positional with default>] <repeated positional>...
+  static constexpr auto write_usage(auto& out) noexcept -> void {
+    out.append("Usage: ").append(program).append(" [options]");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      if (!opts.data[idx].positional) { continue; }
+      auto const optional = *opts.data[idx].defval != '\0';
+      out.append(optional ? " [<" : " <").append(name(idx)).append(optional ? ">]" : ">");
+      if (opts.data[idx].max_count != 0) { out.append("..."); }
+    }
+    out.append("\n\nOptions:\n");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      out.append("  ");
+      write_header(out, idx);
+      for (auto pad = header_size(idx); pad < header_width + 2; ++pad) { out.append(' '); }
+      write_details(out, idx);
+      out.append('\n');
+    }
+  }
+
+  // Completes --name=value from the word up to the cursor, since bash splits it at '='.
+  static constexpr auto write_bash(auto& out) noexcept -> void {
+    out.append('_').append(program).append("() {\n")
+       .append("  local word=${COMP_LINE:0:COMP_POINT}\n")
+       .append("  word=${word##* }\n")
+       .append("  case \"$word\" in\n");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      if (opts.data[idx].ranged) { continue; }
+      out.append("    --").append(name(idx)).append("=*) COMPREPLY=($(compgen -W \"");
+      write_values(out, idx, " ");
+      out.append("\" -- \"${word#*=}\")); return;;\n");
+    }
+    out.append("  esac\n")
+       .append("  case \"${COMP_WORDS[COMP_CWORD-1]}\" in\n");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      if (opts.data[idx].ranged || is_switch(idx)) { continue; }
+      out.append("    --").append(name(idx));
+      if (!short_flag(idx).empty()) { out.append("|-").append(short_flag(idx)); }
+      out.append(") COMPREPLY=($(compgen -W \"");
+      write_values(out, idx, " ");
+      out.append("\" -- \"$word\")); return;;\n");
+    }
+    out.append("  esac\n")
+       .append("  COMPREPLY=($(compgen -W \"");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      out.append(idx == 0 ? "--" : " --").append(name(idx)).append(is_switch(idx) ? "" : "=");
+      if (!short_flag(idx).empty()) { out.append(" -").append(short_flag(idx)); }
+    }
+    out.append("\" -- \"$word\"))\n")
+       .append("}\n")
+       .append("complete -o nospace -F _").append(program).append(' ').append(program).append('\n');
+  }
+
+  static constexpr auto write_zsh_spec(auto& out, size_t idx, std::string_view dashes, std::string_view spelling, 
+                                       std::string_view value_marker) noexcept -> void {
+    out.append(" \\\n  '").append(opts.data[idx].max_count != 0 ? "*" : "").append(dashes).append(spelling);
+    if (is_switch(idx)) { 
+      out.append('[').append(name(idx)).append("]'"); 
+      return; 
+    }
+    out.append(value_marker).append('[').append(name(idx)).append("]:").append(name(idx)).append(':');
+    if (!opts.data[idx].ranged) { 
+      out.append('(');
+      write_values(out, idx, " ");
+      out.append(')');
+    }
+    out.append('\'');
+  }
+
+  static constexpr auto write_zsh(auto& out) noexcept -> void {
+    out.append("#compdef ").append(program).append("\n_arguments -s");
+    for (size_t idx = 0; idx < opts.size; ++idx) {
+      write_zsh_spec(out, idx, "--", name(idx), "=");
+      if (!short_flag(idx).empty()) { write_zsh_spec(out, idx, "-", short_flag(idx), "+"); }
+    }
+    out.append('\n');
+  }
+
+  template <size_t idx>
+  static constexpr auto value_text = make_text<[](auto& out) { write_values(out, idx, " "); }>;
+
+  static constexpr auto usage_text = make_text<[](auto& out) { write_usage(out); }>;
+  static constexpr auto bash_text = make_text<[](auto& out) { write_bash(out); }>;
+  static constexpr auto zsh_text = make_text<[](auto& out) { write_zsh(out); }>;
+
+public:
+
+  static constexpr std::string_view usage{usage_text.view()};
+  static constexpr std::string_view bash_completion{bash_text.view()};
+  static constexpr std::string_view zsh_completion{zsh_text.view()};
+
+  // The allowed values of an option separated by spaces, empty for ranges and any_string.
+  template <literal_string opt>
+  static constexpr std::string_view values = [] {
+    constexpr auto idx = static_cast<size_t>(
+      rng::distance(opts.begin(), rng::find(opts, opt.to_view_remove_suffix(), &option::name)));
+    static_assert(idx != opts.size, "Option is not configured.");
+    if constexpr (idx == opts.size) { return std::string_view{}; }
+    else { return value_text<idx>.view(); }
+  }();
+
+};
+
+// Not inline, so an explicit instantiation declaration (CTCLP_EXTERN_PARSER) keeps the parser tables 
+// out of every translation unit except the one holding CTCLP_INSTANTIATE_PARSER.
+template <options opts>
+auto try_parse(int argc, char const* const* argv) noexcept -> typename parser<opts>::parser_result_t {
+  return parser<opts>::try_parse(argc, argv);
+}
+
+} // ctclp
+
+#define CTCLP_EXTERN_PARSER(opts) \
+  extern template auto ctclp::try_parse<opts>(int, char const* const*) noexcept \
+  -> ctclp::parser<opts>::parser_result_t
+
+#define CTCLP_INSTANTIATE_PARSER(opts) \
+  template auto ctclp::try_parse<opts>(int, char const* const*) noexcept \
+  -> ctclp::parser<opts>::parser_result_t
 
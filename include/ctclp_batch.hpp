@@ -0,0 +1,50 @@
+#pragma once
+
+#include <ctclp.hpp>
+#include <vector>
+#include <thread>
+
+namespace ctclp {
+
+// Parses argument vectors without program name (environment variables are not consulted) into 
+// results[i], which is reused across calls, and returns the number of records without errors. 
+// Records are split into contiguous chunks across thread_count threads.
+template <options opts, error_policy policy, stats_policy statistics>
+class batch_parser {
+
+  using parser_t = parser<opts, policy, statistics>;
+
+public:
+
+  using parser_result_t = typename parser_t::parser_result_t;
+
+  static auto try_parse(std::span<std::span<std::string_view const> const> records, 
+                        std::vector<parser_result_t>& results, size_t thread_count = 1) -> size_t {
+    results.resize(records.size(), parser_result_t{});
+    auto const parse_chunk = [&](size_t first, size_t last) noexcept {
+      for (auto const idx : std::views::iota(first, last)) {
+        parser_t::measured([&]() -> parser_result_t const& {
+          results[idx].reset();
+          parser_t{}.parse_arguments(records[idx], results[idx]);
+          return results[idx];
+        });
+      }
+    };
+
+    auto const chunk_count = std::clamp<size_t>(thread_count, 1, std::max<size_t>(records.size(), 1));
+    auto const chunk_size = (records.size() + chunk_count - 1) / chunk_count;
+    {
+      std::vector<std::jthread> workers{};
+      workers.reserve(chunk_count - 1);
+      for (auto const chunk : std::views::iota(size_t{1}, chunk_count)) {
+        workers.emplace_back(parse_chunk, std::min(chunk * chunk_size, records.size()), 
+                             std::min((chunk + 1) * chunk_size, records.size()));
+      }
+      parse_chunk(0, std::min(chunk_size, records.size()));
+    }
+    return static_cast<size_t>(rng::count_if(results, [](auto const& result) { return static_cast<bool>(result); }));
+  }
+
+};
+
+} // ctclp
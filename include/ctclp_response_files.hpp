@@ -0,0 +1,84 @@
+#pragma once
+
+#include <ctclp.hpp>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ctclp {
+
+class mapped_file {
+public:
+
+  mapped_file() = default;
+
+  explicit mapped_file(char const* path) noexcept {
+    auto const fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { return; }
+    struct stat status{};
+    if (::fstat(fd, &status) == 0) {
+      size = static_cast<size_t>(status.st_size);
+      auto const mapping = size == 0 ? nullptr : ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) { data = static_cast<char const*>(mapping); valid = true; }
+    }
+    ::close(fd);
+  }
+
+  mapped_file(mapped_file&& other) noexcept 
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)}, 
+      valid{std::exchange(other.valid, false)} 
+  {}
+
+  auto operator=(mapped_file&& other) noexcept -> mapped_file& {
+    if (this != &other) {
+      unmap();
+      data = std::exchange(other.data, nullptr);
+      size = std::exchange(other.size, 0);
+      valid = std::exchange(other.valid, false);
+    }
+    return *this;
+  }
+
+  ~mapped_file() { unmap(); }
+
+  explicit operator bool() const noexcept { return valid; }
+
+  auto contents() const noexcept -> std::string_view { return {data, size}; }
+
+private:
+
+  auto unmap() noexcept -> void {
+    if (data != nullptr) { ::munmap(const_cast<char*>(data), size); }
+  }
+
+  char const* data{nullptr};
+  size_t size{0};
+  bool valid{false};
+
+};
+
+template <size_t max_files = 8>
+class response_files {
+public:
+
+  auto open(char const* path) noexcept -> std::optional<std::string_view> {
+    if (count == max_files) { return std::nullopt; }
+    mapped_file file{path};
+    if (!file) { return std::nullopt; }
+    files[count] = std::move(file);
+    return files[count++].contents();
+  }
+
+private:
+
+  std::array<mapped_file, max_files> files{};
+  size_t count{0};
+
+};
+
+} // ctclp
+
+#endif
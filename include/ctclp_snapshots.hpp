@@ -0,0 +1,130 @@
+#pragma once
+
+#include <ctclp.hpp>
+#include <ctclp_response_files.hpp>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ctclp {
+
+// Holds the current parse result behind an atomic pointer. reload parses into a new snapshot that also 
+// owns its response files and publishes it with a pointer exchange only if it is free of errors. Readers 
+// announce the snapshot they use in a hazard slot of their own, so load takes no lock and writes no 
+// shared cache line; a replaced snapshot is deleted once no slot announces it. At most max_readers 
+// guards can be alive at a time, further loads wait for a free slot.
+template <options opts, size_t max_files = 8, size_t max_readers = 64>
+class snapshots {
+
+  struct snapshot {
+
+#if __has_include(<sys/mman.h>)
+    snapshot(int argc, char const* const* argv) : result{parser<opts>::try_parse(argc, argv, files)} {}
+
+    response_files<max_files> files{};
+#else
+    snapshot(int argc, char const* const* argv) : result{parser<opts>::try_parse(argc, argv)} {}
+#endif
+    typename parser<opts>::parser_result_t result;
+
+  };
+
+  struct alignas(64) hazard_slot {
+
+    std::atomic<bool> used{false};
+    std::atomic<snapshot const*> hazard{nullptr};
+
+  };
+
+public:
+
+  using parser_result_t = typename parser<opts>::parser_result_t;
+
+  // Keeps one snapshot alive while it is read.
+  class guard {
+  public:
+
+    guard(guard&& other) noexcept : slot{std::exchange(other.slot, nullptr)}, loaded{other.loaded} {}
+    auto operator=(guard&&) -> guard& = delete;
+
+    ~guard() {
+      if (slot == nullptr) { return; }
+      slot->hazard.store(nullptr, std::memory_order_release);
+      slot->used.store(false, std::memory_order_release);
+    }
+
+    auto operator*() const noexcept -> parser_result_t const& { return loaded->result; }
+    auto operator->() const noexcept -> parser_result_t const* { return &loaded->result; }
+
+  private:
+
+    friend class snapshots;
+
+    guard(hazard_slot& slot, snapshot const* loaded) noexcept : slot{&slot}, loaded{loaded} {}
+
+    hazard_slot* slot;
+    snapshot const* loaded;
+
+  };
+
+  snapshots(int argc, char const* const* argv) : current{new snapshot const{argc, argv}} {}
+  snapshots(snapshots const&) = delete;
+  auto operator=(snapshots const&) -> snapshots& = delete;
+
+  // Requires that no guard is alive.
+  ~snapshots() {
+    delete current.load(std::memory_order_relaxed);
+    for (auto const retired_snapshot : retired) { delete retired_snapshot; }
+  }
+
+  auto load() const noexcept -> guard {
+    auto& slot = acquire_slot();
+    auto loaded = current.load(std::memory_order_acquire);
+    for (;;) {
+      slot.hazard.store(loaded, std::memory_order_seq_cst);
+      auto const confirmed = current.load(std::memory_order_seq_cst);
+      if (confirmed == loaded) { return guard{slot, loaded}; }
+      loaded = confirmed;
+    }
+  }
+
+  // Writers are serialized; the returned guard refers to the new snapshot whether it was published or not.
+  auto reload(int argc, char const* const* argv) -> guard {
+    auto const next = new snapshot const{argc, argv};
+    auto& slot = acquire_slot();
+    slot.hazard.store(next, std::memory_order_seq_cst);
+
+    std::scoped_lock const lock{writer};
+    retired.push_back(next->result ? current.exchange(next, std::memory_order_seq_cst) : next);
+    std::erase_if(retired, [this](snapshot const* retired_snapshot) {
+      auto const announced = rng::any_of(slots, [&](hazard_slot const& other) { 
+        return other.hazard.load(std::memory_order_seq_cst) == retired_snapshot; 
+      });
+      if (!announced) { delete retired_snapshot; }
+      return !announced;
+    });
+    return guard{slot, next};
+  }
+
+private:
+
+  auto acquire_slot() const noexcept -> hazard_slot& {
+    auto const first = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    for (size_t attempt = 0;; ++attempt) {
+      auto& slot = slots[(first + attempt) % max_readers];
+      if (!slot.used.load(std::memory_order_relaxed) && !slot.used.exchange(true, std::memory_order_acquire)) {
+        return slot;
+      }
+      if (attempt % max_readers == max_readers - 1) { std::this_thread::yield(); }
+    }
+  }
+
+  std::atomic<snapshot const*> current;
+  mutable std::array<hazard_slot, max_readers> slots{};
+  std::mutex writer{};
+  std::vector<snapshot const*> retired{};
+
+};
+
+} // ctclp
@@ -0,0 +1,3 @@
+#include "ctclp_extern_options.hpp"
+
+CTCLP_INSTANTIATE_PARSER(extern_opts);
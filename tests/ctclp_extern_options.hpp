@@ -0,0 +1,11 @@
+#pragma once
+
+#include <ctclp.hpp>
+
+// Shared by the two translation units of ctclp_extern_tests: ctclp_extern_options.cpp instantiates the 
+// parser, ctclp_extern_tests.cpp only sees the extern declaration.
+inline constexpr auto extern_opts = ctclp::options<2>{}
+  .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, ctclp::default_value<"8080">>()
+  .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">, ctclp::default_value<"celsius">>();
+
+CTCLP_EXTERN_PARSER(extern_opts);
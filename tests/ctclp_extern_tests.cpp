@@ -0,0 +1,25 @@
+#include "ctclp_extern_options.hpp"
+#include <iostream>
+#include <sstream>
+
+// Links against the parser instantiated in ctclp_extern_options.cpp, so everything the header defines 
+// outside of templates must be inline.
+auto main() -> int {
+    char const* argv[]{"programm", "--port=443", "--unit=kelvin"};
+    auto const parser_result = ctclp::try_parse<extern_opts>(3, argv);
+    if (!parser_result || *parser_result.get<"port", int>().first != 443 || 
+        *parser_result.get<"unit", std::string_view>().first != "kelvin") {
+        std::cerr << "Extern parser: values do not match\n";
+        return 1;
+    }
+
+    char const* failing_argv[]{"programm", "--port=0"};
+    auto const failed_result = ctclp::try_parse<extern_opts>(2, failing_argv);
+    std::ostringstream errors{};
+    errors << failed_result.errors;
+    if (failed_result || errors.str().find("out_of_range") == std::string::npos) {
+        std::cerr << "Extern parser: errors do not match\n";
+        return 1;
+    }
+    return 0;
+}
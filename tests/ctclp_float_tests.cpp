@@ -0,0 +1,72 @@
+#include <ctclp.hpp>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+
+// Round-trips floating-point values through their decimal representation and checks that the
+// constexpr conversion agrees bit for bit with strtod/strtof. Pass --exhaustive to check every
+// finite float instead of a random sample.
+
+template <std::floating_point value_t>
+auto check(std::string_view str, long& failures) -> void {
+  auto const result = ctclp::decimal_to_floating_point<value_t>(str);
+  std::string const input{str};
+  auto const expected = std::is_same_v<value_t, float> ? std::strtof(input.c_str(), nullptr) 
+                                                       : std::strtod(input.c_str(), nullptr);
+  if (result && std::bit_cast<std::array<char, sizeof(value_t)>>(*result) == 
+                std::bit_cast<std::array<char, sizeof(value_t)>>(static_cast<value_t>(expected))) { return; }
+  if (failures++ < 10) { std::fprintf(stderr, "mismatch: %s\n", input.c_str()); }
+}
+
+template <std::floating_point value_t>
+auto check_round_trip(value_t value, long& failures) -> void {
+  if (!std::isfinite(value)) { return; }
+  std::array<char, 1200> buffer{};
+  auto const shortest = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  check<value_t>({buffer.data(), shortest.ptr}, failures);
+  auto const scientific = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, 
+                                        std::chars_format::scientific, std::numeric_limits<value_t>::max_digits10);
+  check<value_t>({buffer.data(), scientific.ptr}, failures);
+}
+
+auto check_halfway(double value, long& failures) -> void {
+  auto const next = std::nextafter(value, std::numeric_limits<double>::infinity());
+  if (!std::isfinite(value) || !std::isfinite(next)) { return; }
+  std::array<char, 1200> buffer{};
+  auto const halfway = (static_cast<long double>(value) + next) / 2;
+  auto const length = std::snprintf(buffer.data(), buffer.size(), "%.1100Le", halfway);
+  check<double>({buffer.data(), static_cast<size_t>(length)}, failures);
+}
+
+auto main(int argc, char** argv) -> int {
+  long failures{0};
+  std::mt19937_64 random{2024};
+
+  if (argc > 1 && std::string_view{argv[1]} == "--exhaustive") {
+    for (std::uint64_t bits{0}; bits <= std::numeric_limits<std::uint32_t>::max(); ++bits) {
+      check_round_trip(std::bit_cast<float>(static_cast<std::uint32_t>(bits)), failures);
+    }
+  } else {
+    for (auto i = 0; i < 1'000'000; ++i) { 
+      check_round_trip(std::bit_cast<float>(static_cast<std::uint32_t>(random())), failures); 
+    }
+  }
+  for (auto i = 0; i < 1'000'000; ++i) { check_round_trip(std::bit_cast<double>(random()), failures); }
+  for (auto i = 0; i < 10'000; ++i) { check_halfway(std::bit_cast<double>(random() >> 1), failures); }
+
+  for (auto str : {"0", "-0", "1e-6", "0.1", "9007199254740993", "1.7976931348623157e308", 
+                   "4.9e-324", "2.4703282292062328e-324", "2.2250738585072011e-308", 
+                   "123456789012345678901234567890.123456789", ".5", "5.", "1E+3"}) {
+    check<double>(str, failures);
+  }
+
+  std::printf("floating-point round trip: %ld failures\n", failures);
+  return failures == 0 ? 0 : 1;
+}
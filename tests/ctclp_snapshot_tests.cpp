@@ -0,0 +1,58 @@
+#include <ctclp_snapshots.hpp>
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr auto opts = ctclp::options<2>{}
+  .add<"generation", ctclp::option::integral, ctclp::range<0, 1000000>, ctclp::default_value<"0">>()
+  .add<"copy", ctclp::option::integral, ctclp::range<0, 1000000>, ctclp::default_value<"0">>();
+
+constexpr auto reader_count = 8;
+constexpr auto reload_count = 20000;
+
+} // namespace
+
+// Readers load while one writer reloads; every snapshot must stay intact and the published
+// generations must not go back. Run under a thread or address sanitizer to check the reclamation.
+auto main() -> int {
+    char const* initial_argv[]{"programm"};
+    ctclp::snapshots<opts> config{1, initial_argv};
+    std::atomic<bool> reloading{true};
+    std::atomic<int> failures{0};
+
+    {
+        std::vector<std::jthread> readers{};
+        for (auto reader = 0; reader < reader_count; ++reader) {
+            readers.emplace_back([&] {
+                auto last_generation = 0;
+                while (reloading.load(std::memory_order_relaxed)) {
+                    auto const current = config.load();
+                    auto const generation = *current->get<"generation", int>().first;
+                    if (!*current || generation != *current->get<"copy", int>().first || generation < last_generation) {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    last_generation = generation;
+                }
+            });
+        }
+
+        for (auto generation = 1; generation <= reload_count; ++generation) {
+            auto const value = std::to_string(generation);
+            auto const generation_argument = "--generation=" + value;
+            // Every 100th reload fails and must not be published.
+            auto const copy_argument = "--copy=" + (generation % 100 == 0 ? std::string{"-1"} : value);
+            char const* argv[]{"programm", generation_argument.c_str(), copy_argument.c_str()};
+            if (static_cast<bool>(*config.reload(3, argv)) == (generation % 100 == 0)) {
+                failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        reloading.store(false, std::memory_order_relaxed);
+    }
+
+    if (failures.load() != 0 || *config.load()->get<"generation", int>().first != reload_count - 1) {
+        std::cerr << "Snapshots: " << failures.load() << " inconsistent loads or reloads\n";
+        return 1;
+    }
+    return 0;
+}
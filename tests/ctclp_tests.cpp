@@ -1,5 +1,11 @@
 #include <ctclp.hpp>
+#include <ctclp_batch.hpp>
+#include <ctclp_response_files.hpp>
+#include <ctclp_snapshots.hpp>
 #include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <cstdlib>
 
 consteval auto test_string() noexcept {
   static constexpr auto opts = ctclp::options<1>{}
@@ -8,7 +14,7 @@ consteval auto test_string() noexcept {
                  ctclp::default_value<"debug">>();
   static constexpr char const* argv[] = {"programm", "--mode=release"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_string: parsing failed."); 
   static constexpr auto result = parser_result.template get<"mode", std::string_view>();
   static_assert(*result.first == "release", "test_string: result does not match.");
@@ -21,7 +27,7 @@ consteval auto test_string_default_value() noexcept {
                  ctclp::default_value<"debug">>();
   static constexpr char const* argv[] = {"programm"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_string_default_value: parsing failed."); 
   static constexpr auto result = parser_result.template get<"mode", std::string_view>();
   static_assert(*result.first == "debug", "test_string_default_value: result does not match.");
@@ -34,7 +40,7 @@ consteval auto test_integral() noexcept {
                 ctclp::default_value<"22">>();
   static constexpr char const* argv[] = {"programm", "--age=38"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_integral: parsing failed."); 
   static constexpr auto result = parser_result.template get<"age", int>();
   static_assert(*result.first == 38, "test_integral: result does not match.");
@@ -47,12 +53,29 @@ consteval auto test_integral_default_value() noexcept {
                 ctclp::default_value<"22">>();
   static constexpr char const* argv[] = {"programm"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_integral_default_value: parsing failed."); 
   static constexpr auto result = parser_result.template get<"age", int>();
   static_assert(*result.first == 22, "test_integral_default_value: result does not match.");
 }
 
+consteval auto test_converted_default_value() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"limit", ctclp::option::integral, ctclp::range<0, 100000>, ctclp::default_value<"70000">>();
+  static constexpr char const* argv[] = {"programm"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_converted_default_value: parsing failed."); 
+  static constexpr auto as_long = parser_result.template get<"limit", long>();
+  static_assert(*as_long.first == 70000, "test_converted_default_value: result does not match.");
+  static constexpr auto as_short = parser_result.template get<"limit", short>();
+  static_assert(as_short.second == ctclp::error_code::out_of_range, 
+                "test_converted_default_value: narrowing should be rejected.");
+  static constexpr auto as_string = parser_result.template get<"limit", std::string_view>();
+  static_assert(as_string.second == ctclp::error_code::incorrect_type, 
+                "test_converted_default_value: type mismatch should be rejected.");
+}
+
 consteval auto test_floating_point() noexcept {
   static constexpr auto opts = ctclp::options<1>{}
     .add<"amount", ctclp::option::floating_point, 
@@ -60,7 +83,7 @@ consteval auto test_floating_point() noexcept {
                    ctclp::default_value<"-0.0012345">>();
   static constexpr char const* argv[] = {"programm", "--amount=0.0001"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_floating_point: parsing failed."); 
   static constexpr auto result = parser_result.template get<"amount", double>();
   static_assert(*result.first == 0.0001, "test_floating: result does not match.");
@@ -73,7 +96,7 @@ consteval auto test_floating_point_default_value() {
                    ctclp::default_value<"-0.0012345">>();
   static constexpr char const* argv[] = {"programm"}; 
   static constexpr auto argc = std::size(argv);
-  static constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_floating_point_default_value: parsing failed."); 
   static constexpr auto result = parser_result.template get<"amount", double>();
   static_assert(*result.first == -0.0012345, "test_floating_point_default_value: result does not match.");
@@ -84,7 +107,7 @@ consteval auto test_unknown_parameter() {
     .add<"para1", ctclp::option::integral, ctclp::values<"1", "2">>();
   static constexpr char const* argv[] = {"programm", "--para2=99"}; 
   static constexpr auto argc = std::size(argv);
-  constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(!parser_result, "test_unknown_parameter: parser should fail on unknown param.");
 }
 
@@ -93,7 +116,7 @@ consteval auto test_invalid_integral() noexcept {
     .add<"id", ctclp::option::integral, ctclp::values<"100", "200">>();
   static constexpr char const* argv[] = {"programm", "--id=ABC"}; 
   static constexpr auto argc = std::size(argv);
-  constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(!parser_result, "test_invalid_integral: parser should fail on invalid number.");
 }
 
@@ -103,7 +126,7 @@ consteval auto test_invalid_floating_point() {
                 ctclp::values<"3.14", "2.71">>();
   static constexpr char const* argv[] = {"programm", "--val=notafloat"}; 
   static constexpr auto argc = std::size(argv);
-  constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(!parser_result, "test_invalid_floating_point: parser should fail on invalid float.");
 }
 
@@ -121,7 +144,7 @@ consteval auto test_multiple_options() noexcept {
       "programm", "--x=2", "--y=blue", "--z=1.5", "--flag=1", "--small=20", "--big=200000", "--float_val=3.14"
   };
   static constexpr auto argc = std::size(argv);
-  constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(parser_result, "test_multiple_options: parser should succeed.");
 
   constexpr auto res_x = parser_result.get<"x", int>();
@@ -146,10 +169,430 @@ consteval auto test_empty_value() noexcept {
     .add<"para", ctclp::option::string, ctclp::values<"A", "B">>();
   static constexpr char const* argv[] = {"programm", "--para="}; 
   static constexpr auto argc = std::size(argv);
-  constexpr auto parser_result = ctclp::parser<opts, 256>::try_parse<argc, argv>();
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
   static_assert(!parser_result, "test_empty_value: parser should fail on empty value.");
 }
 
+consteval auto test_overlapping_option_names() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"count", ctclp::option::integral, ctclp::values<"1", "5", "10">, ctclp::default_value<"10">>()
+    .add<"max_count", ctclp::option::integral, ctclp::values<"1", "5">>();
+  static constexpr char const* argv[] = {"programm", "--max_count=5"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_overlapping_option_names: parsing failed.");
+  static_assert(*parser_result.template get<"count", int>().first == 10, 
+                "test_overlapping_option_names: count should keep its default value.");
+  static_assert(*parser_result.template get<"max_count", int>().first == 5, 
+                "test_overlapping_option_names: max_count does not match.");
+}
+
+consteval auto test_option_name_prefix() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"count", ctclp::option::integral, ctclp::values<"1", "10">>();
+  static constexpr char const* argv[] = {"programm", "--coun=1"}; 
+  static constexpr auto argc = std::size(argv);
+  constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(!parser_result, "test_option_name_prefix: parser should fail on a name prefix.");
+}
+
+consteval auto test_runtime_arguments() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"mode", ctclp::option::string, 
+                 ctclp::values<"debug", "release">,
+                 ctclp::default_value<"debug">>();
+  static constexpr char const* argv[] = {"programm", "--mode=debug", "--mode=release"}; 
+  static constexpr auto argc = static_cast<int>(std::size(argv));
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse(argc, argv);
+  static_assert(parser_result, "test_runtime_arguments: parsing failed."); 
+  static constexpr auto result = parser_result.template get<"mode", std::string_view>();
+  static_assert(*result.first == "release", "test_runtime_arguments: the last occurrence should win.");
+}
+
+consteval auto test_value_prefixes() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"count", ctclp::option::integral, ctclp::values<"1", "10", "100">>();
+  static constexpr char const* argv[] = {"programm", "--count=10"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_value_prefixes: parsing failed."); 
+  static_assert(*parser_result.template get<"count", int>().first == 10, 
+                "test_value_prefixes: result does not match.");
+
+  static constexpr char const* argv_too_long[] = {"programm", "--count=1000"}; 
+  static constexpr auto argc_too_long = std::size(argv_too_long);
+  constexpr auto failed_result = ctclp::parser<opts>::try_parse<argc_too_long, argv_too_long>();
+  static_assert(!failed_result, "test_value_prefixes: parser should fail on an extended value.");
+}
+
+consteval auto test_many_values() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"region", ctclp::option::string, 
+                   ctclp::values<"eu-west-1", "eu-west-2", "eu-west-3", "eu-central-1", "eu-north-1",
+                                 "us-east-1", "us-east-2", "us-west-1", "us-west-2", "ap-south-1",
+                                 "ap-northeast-1", "ap-northeast-2", "ap-southeast-1", "ap-southeast-2",
+                                 "ca-central-1", "sa-east-1">,
+                   ctclp::default_value<"eu-west-1">>();
+  static constexpr char const* argv[] = {"programm", "--region=sa-east-1"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_many_values: parsing failed."); 
+  static constexpr auto result = parser_result.template get<"region", std::string_view>();
+  static_assert(*result.first == "sa-east-1", "test_many_values: result does not match.");
+  static constexpr auto all = parser_result.template get_all<"region", std::string_view>();
+  static_assert(all.first->size() == 1 && all.first->front() == "sa-east-1", 
+                "test_many_values: the stored value should be returned as a span.");
+}
+
+consteval auto test_floating_point_exponent() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"epsilon", ctclp::option::floating_point, ctclp::values<"1e-6", "2.5E3", "0.1">>();
+  static constexpr char const* argv[] = {"programm", "--epsilon=1e-6"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_floating_point_exponent: parsing failed."); 
+  static constexpr auto result = parser_result.template get<"epsilon", double>();
+  static_assert(*result.first == 1e-6, "test_floating_point_exponent: result does not match.");
+  static_assert(*ctclp::to_floating_point<double>("0.1") == 0.1, 
+                "test_floating_point_exponent: conversion is not correctly rounded.");
+  static_assert(!ctclp::to_floating_point<double>("1e400"), 
+                "test_floating_point_exponent: conversion should fail on overflow.");
+}
+
+consteval auto test_narrow_floating_point() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"scale", ctclp::option::floating_point, ctclp::values<"0.5", "1e39", "-1e39">>();
+  static constexpr char const* argv[] = {"programm", "--scale=1e39"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_narrow_floating_point: parsing failed."); 
+  static_assert(parser_result.template get<"scale", float>().second == ctclp::error_code::out_of_range, 
+                "test_narrow_floating_point: a value beyond float should be out of range.");
+  static_assert(*parser_result.template get<"scale", double>().first == 1e39, 
+                "test_narrow_floating_point: result does not match.");
+}
+
+consteval auto test_integral_range() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, ctclp::default_value<"8080">>()
+    .add<"ratio", ctclp::option::floating_point, ctclp::range<0.0, 1.0>>();
+  static constexpr char const* argv[] = {"programm", "--port=443", "--ratio=0.25"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_integral_range: parsing failed."); 
+  static constexpr auto port = parser_result.template get<"port", int>();
+  static_assert(*port.first == 443, "test_integral_range: port does not match.");
+  static_assert(parser_result.template get_all<"port", long long>().second == ctclp::error_code::incorrect_type, 
+                "test_integral_range: a narrowed value has no span.");
+  static constexpr auto ratio = parser_result.template get<"ratio", double>();
+  static_assert(*ratio.first == 0.25, "test_integral_range: ratio does not match.");
+
+  static constexpr char const* argv_out_of_range[] = {"programm", "--port=65536"}; 
+  static constexpr auto argc_out_of_range = std::size(argv_out_of_range);
+  constexpr auto failed_result = ctclp::parser<opts>::try_parse<argc_out_of_range, argv_out_of_range>();
+  static_assert(!failed_result, "test_integral_range: parser should fail on an out-of-range value.");
+}
+
+consteval auto test_any_integral() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"offset", ctclp::option::integral, ctclp::any_integral, ctclp::default_value<"0">>();
+  static constexpr char const* argv[] = {"programm", "--offset=-9223372036854775808"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_any_integral: parsing failed."); 
+  static constexpr auto result = parser_result.template get<"offset", long long>();
+  static_assert(*result.first == std::numeric_limits<long long>::min(), "test_any_integral: result does not match.");
+
+  static constexpr char const* argv_overflow[] = {"programm", "--offset=9223372036854775808"}; 
+  static constexpr auto argc_overflow = std::size(argv_overflow);
+  constexpr auto failed_result = ctclp::parser<opts>::try_parse<argc_overflow, argv_overflow>();
+  static_assert(!failed_result, "test_any_integral: parser should fail on overflow.");
+}
+
+consteval auto test_integral_format() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"mask", ctclp::option::integral, 
+                 ctclp::range<0, 0xFFFF, ctclp::number_format{.prefixes = true, .separators = true}>, 
+                 ctclp::default_value<"0xFF">>()
+    .add<"count", ctclp::option::integral, ctclp::any_integral>();
+  static constexpr char const* argv[] = {"programm", "--mask=0b1010_1010", "--count=100000"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_integral_format: parsing failed."); 
+  static constexpr auto mask = parser_result.template get<"mask", int>();
+  static_assert(*mask.first == 0xAA, "test_integral_format: mask does not match.");
+  static constexpr auto count = parser_result.template get<"count", short>();
+  static_assert(*count.second == ctclp::error_code::out_of_range, 
+                "test_integral_format: narrowing should fail with out_of_range.");
+}
+
+consteval auto test_environment_attribute() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, 
+                 ctclp::env<"CTCLP_PORT">, ctclp::default_value<"8080">>()
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">, 
+                 ctclp::default_value<"celsius">, ctclp::env<"CTCLP_UNIT">>();
+  static constexpr char const* argv[] = {"programm", "--unit=kelvin"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_environment_attribute: parsing failed."); 
+  static constexpr auto port = parser_result.template get<"port", int>();
+  static_assert(*port.first == 8080, "test_environment_attribute: default value does not match.");
+  static constexpr auto unit = parser_result.template get<"unit", std::string_view>();
+  static_assert(*unit.first == "kelvin", "test_environment_attribute: unit does not match.");
+}
+
+consteval auto test_repeated_option() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"shard", ctclp::option::integral, ctclp::range<0, 1023>, ctclp::repeat<4>>()
+    .add<"tag", ctclp::option::string, ctclp::values<"fast", "slow">, 
+                ctclp::repeat<2>, ctclp::default_value<"fast">>();
+  static constexpr char const* argv[] = {"programm", "--shard=3", "--shard=1", "--shard=2"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_repeated_option: parsing failed."); 
+  static constexpr auto shards = parser_result.template get_all<"shard", long long>();
+  static_assert(std::ranges::equal(*shards.first, std::array{3LL, 1LL, 2LL}), "test_repeated_option: shards do not match.");
+  static constexpr auto tags = parser_result.template get_all<"tag", std::string_view>();
+  static_assert(tags.first->size() == 1 && tags.first->front() == "fast", 
+                "test_repeated_option: default tag does not match.");
+
+  static constexpr char const* argv_too_many[] = {"programm", "--tag=fast", "--tag=slow", "--tag=fast"}; 
+  static constexpr auto argc_too_many = std::size(argv_too_many);
+  constexpr auto failed_result = ctclp::parser<opts>::try_parse<argc_too_many, argv_too_many>();
+  static_assert(!failed_result, "test_repeated_option: parser should fail when the repeat limit is exceeded.");
+}
+
+consteval auto test_error_suggestions() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "fahrenheit", "kelvin">>()
+    .add<"count", ctclp::option::integral, ctclp::values<"1", "10", "100">>();
+  static constexpr char const* argv[] = {"programm", "--unit=kelvni", "--cuont=10"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(!parser_result, "test_error_suggestions: parser should fail for misspelled input.");
+  static constexpr auto value_error = parser_result.errors.data[0];
+  static_assert(value_error.argument == 0 && parser_result.errors.option_name(value_error) == "unit" && 
+                parser_result.errors.suggestion(value_error) == "kelvin", 
+                "test_error_suggestions: value suggestion does not match.");
+  static constexpr auto name_error = parser_result.errors.data[1];
+  static_assert(name_error.argument == 1 && parser_result.errors.option_name(name_error).empty() && 
+                parser_result.errors.suggestion(name_error) == "count", 
+                "test_error_suggestions: option suggestion does not match.");
+
+  static constexpr char const* argv_distant[] = {"programm", "--zzzzzzzz=1", "--unit=x"}; 
+  static constexpr auto argc_distant = std::size(argv_distant);
+  static constexpr auto distant_result = ctclp::parser<opts>::try_parse<argc_distant, argv_distant>();
+  static_assert(distant_result.errors.suggestion(distant_result.errors.data[0]).empty() && 
+                distant_result.errors.suggestion(distant_result.errors.data[1]).empty(), 
+                "test_error_suggestions: distant input should not get a suggestion.");
+}
+
+consteval auto test_error_capacity() noexcept {
+  static constexpr auto opts = ctclp::options<1>{}
+    .add<"count", ctclp::option::integral, ctclp::values<"1", "10", "100">>();
+  static constexpr char const* argv[] = {"programm", "--count=2", "--count=3", "--size=1"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result.errors.right_size == 3 && parser_result.errors.data.size() == 8, 
+                "test_error_capacity: the default capacity should store all errors.");
+  static_assert(sizeof(ctclp::parse_error_info) <= 12, "test_error_capacity: error records should stay compact.");
+  static constexpr auto fail_fast_result = 
+    ctclp::parser<opts, ctclp::error_policy{.fail_fast = true}>::try_parse<argc, argv>();
+  static_assert(fail_fast_result.errors.count() == 1, "test_error_capacity: fail-fast should stop at the first error.");
+  static constexpr auto capped_result = ctclp::parser<opts, ctclp::error_policy{.capacity = 1}>::try_parse<argc, argv>();
+  static_assert(capped_result.errors.right_size == 1 && capped_result.errors.count() == 3, 
+                "test_error_capacity: errors beyond the capacity should only be counted.");
+}
+
+consteval auto test_short_names_and_switches() noexcept {
+  static constexpr auto opts = ctclp::options<3>{}
+    .add<"verbose", ctclp::option::integral, ctclp::values<"0", "1">, 
+                    ctclp::short_name<'v'>, ctclp::default_value<"0">, ctclp::implicit_value<"1">>()
+    .add<"level", ctclp::option::integral, ctclp::range<0, 9>, ctclp::short_name<'l'>>()
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">>();
+  static constexpr char const* argv[] = {"programm", "-v", "-l", "7", "--unit", "kelvin"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_short_names_and_switches: parsing failed."); 
+  static_assert(*parser_result.template get<"verbose", bool>().first, 
+                "test_short_names_and_switches: verbose should be set.");
+  static_assert(*parser_result.template get<"level", int>().first == 7, 
+                "test_short_names_and_switches: level does not match.");
+  static_assert(*parser_result.template get<"unit", std::string_view>().first == "kelvin", 
+                "test_short_names_and_switches: unit does not match.");
+
+  static constexpr char const* argv_attached[] = {"programm", "--verbose", "-l3"}; 
+  static constexpr auto argc_attached = std::size(argv_attached);
+  static constexpr auto attached_result = ctclp::parser<opts>::try_parse<argc_attached, argv_attached>();
+  static_assert(attached_result && *attached_result.template get<"level", int>().first == 3, 
+                "test_short_names_and_switches: attached short value does not match.");
+
+  static constexpr char const* argv_missing[] = {"programm", "--level"}; 
+  static constexpr auto argc_missing = std::size(argv_missing);
+  static constexpr auto missing_result = ctclp::parser<opts>::try_parse<argc_missing, argv_missing>();
+  static_assert(!missing_result && missing_result.errors.data[0].code == ctclp::error_code::missing_value, 
+                "test_short_names_and_switches: a trailing option without value should fail.");
+}
+
+consteval auto test_commands() noexcept {
+  static constexpr auto global_opts = ctclp::options<1>{}
+    .add<"verbose", ctclp::option::integral, ctclp::values<"0", "1">, 
+                    ctclp::default_value<"0">, ctclp::implicit_value<"1">>();
+  static constexpr auto build_opts = ctclp::options<1>{}
+    .add<"jobs", ctclp::option::integral, ctclp::range<1, 64>, ctclp::default_value<"1">>();
+  static constexpr auto test_opts = ctclp::options<1>{}
+    .add<"filter", ctclp::option::string, ctclp::any_string>();
+  using cli = ctclp::commands<global_opts, ctclp::command<"build", build_opts>, ctclp::command<"test", test_opts>>;
+
+  static constexpr char const* argv[] = {"programm", "--verbose", "build", "--jobs", "8"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = cli::try_parse<argc, argv>();
+  static_assert(parser_result && parser_result.command() == "build", "test_commands: parsing failed."); 
+  static_assert(*parser_result.global.template get<"verbose", bool>().first, "test_commands: verbose should be set.");
+  static_assert(*parser_result.template get<"build">()->template get<"jobs", int>().first == 8, 
+                "test_commands: jobs does not match.");
+  static_assert(parser_result.template get<"test">() == nullptr, "test_commands: test should not be selected.");
+
+  static constexpr char const* argv_misplaced[] = {"programm", "test", "--jobs=8"}; 
+  static constexpr auto argc_misplaced = std::size(argv_misplaced);
+  static constexpr auto misplaced_result = cli::try_parse<argc_misplaced, argv_misplaced>();
+  static_assert(!misplaced_result, "test_commands: options of another command should fail.");
+
+  static constexpr char const* argv_unknown[] = {"programm", "biuld"}; 
+  static constexpr auto argc_unknown = std::size(argv_unknown);
+  static constexpr auto unknown_result = cli::try_parse<argc_unknown, argv_unknown>();
+  static_assert(!unknown_result && unknown_result.global.errors.data[0].code == ctclp::error_code::unknown_command && 
+                unknown_result.global.errors.suggestion(unknown_result.global.errors.data[0]) == "build", 
+                "test_commands: an unknown command should suggest the nearest one.");
+}
+
+consteval auto test_stream_parser() noexcept {
+  static constexpr auto opts = ctclp::options<2>{}
+    .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, ctclp::default_value<"8080">>()
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">>();
+  static constexpr auto parser_result = [] {
+    ctclp::stream_parser<opts, 16> stream{};
+    for (auto chunk : {std::string_view{"--po"}, std::string_view{"rt=90"}, std::string_view{"80\n--unit\n"}, 
+                       std::string_view{"kel"}, std::string_view{"vin\0--port=1"}}) { 
+      stream.feed(chunk); 
+    }
+    return stream.finish();
+  }();
+  static_assert(parser_result, "test_stream_parser: parsing failed."); 
+  static_assert(*parser_result.template get<"port", int>().first == 1, "test_stream_parser: port does not match.");
+  static_assert(*parser_result.template get<"unit", std::string_view>().first == "kelvin", 
+                "test_stream_parser: unit does not match.");
+
+  static_assert([] {
+    ctclp::stream_parser<opts, 16> stream{};
+    stream.feed("--unit=kelvin --port=1");
+    stream.feed("0\n--port=10\n");
+    auto const& result = stream.finish();
+    return result.errors.count() == 1 && *result.template get<"port", int>().first == 10;
+  }(), "test_stream_parser: an oversized token should be reported and skipped.");
+
+  static_assert([] {
+    ctclp::stream_parser<opts, 16> stream{};
+    {
+      std::array<char, 7> chunk{'-', '-', 'u', 'n', 'i', 't', '\n'};
+      stream.feed({chunk.data(), chunk.size()});
+    }
+    auto const& result = stream.finish();
+    return result.errors.count() == 1 && result.errors.data[0].code == ctclp::error_code::missing_value && 
+           result.errors.option_name(result.errors.data[0]) == "unit";
+  }(), "test_stream_parser: a missing value at the end should name the option.");
+
+  static constexpr auto repeated_opts = ctclp::options<2>{}
+    .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, ctclp::default_value<"8080">>()
+    .add<"shard", ctclp::option::integral, ctclp::range<0, 1023>, ctclp::repeat<2>>();
+  static_assert([] {
+    ctclp::stream_parser<repeated_opts, 16> stream{};
+    stream.feed("--shard=1\n--shard=2\n--port=1\n");
+    stream.finish();
+    stream.feed("--shard=3\n");
+    auto const& result = stream.finish();
+    auto const shards = *result.template get_all<"shard", long long>().first;
+    return result && shards.size() == 1 && shards[0] == 3 && *result.template get<"port", int>().first == 1 && 
+           !stream.finish().template get<"shard", int>().first;
+  }(), "test_stream_parser: repeated options should be collected anew in each round.");
+}
+
+struct server_config {
+  int port{};
+  short level{};
+  std::string_view unit{};
+  bool verbose{};
+};
+
+consteval auto test_parse_into() noexcept {
+  static constexpr auto opts = ctclp::options<4>{}
+    .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, ctclp::default_value<"8080">>()
+    .add<"level", ctclp::option::integral, ctclp::range<0, 100000>, ctclp::default_value<"3">>()
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">, ctclp::default_value<"celsius">>()
+    .add<"verbose", ctclp::option::integral, ctclp::values<"0", "1">, ctclp::implicit_value<"1">>();
+  using parser = ctclp::parser<opts>;
+  static constexpr char const* argv[] = {"programm", "--unit=kelvin", "--verbose"}; 
+  static constexpr auto argc = static_cast<int>(std::size(argv));
+  static constexpr auto parser_result = parser::try_parse_into<server_config, 
+    ctclp::bind<"port", &server_config::port>, ctclp::bind<"level", &server_config::level>, 
+    ctclp::bind<"unit", &server_config::unit>, ctclp::bind<"verbose", &server_config::verbose>>(argc, argv);
+  static_assert(parser_result, "test_parse_into: parsing failed."); 
+  static_assert(parser_result.config.port == 8080 && parser_result.config.level == 3, 
+                "test_parse_into: default values do not match.");
+  static_assert(parser_result.config.unit == "kelvin" && parser_result.config.verbose, 
+                "test_parse_into: parsed values do not match.");
+
+  static constexpr char const* argv_narrow[] = {"programm", "--level=40000"}; 
+  static constexpr auto narrow_result = parser::try_parse_into<server_config, 
+    ctclp::bind<"level", &server_config::level>>(static_cast<int>(std::size(argv_narrow)), argv_narrow);
+  static_assert(!narrow_result && narrow_result.errors.data[0].code == ctclp::error_code::out_of_range, 
+                "test_parse_into: a value that does not fit the member should fail.");
+}
+
+consteval auto test_positional_arguments() noexcept {
+  static constexpr auto opts = ctclp::options<3>{}
+    .add<"mode", ctclp::option::string, ctclp::values<"build", "test">, ctclp::positional>()
+    .add<"files", ctclp::option::string, ctclp::any_string, ctclp::positional, ctclp::repeat<4>>()
+    .add<"jobs", ctclp::option::integral, ctclp::range<1, 64>, ctclp::default_value<"1">>();
+  static constexpr char const* argv[] = {"programm", "test", "--jobs=4", "a.cpp", "--", "--b.cpp"}; 
+  static constexpr auto argc = std::size(argv);
+  static constexpr auto parser_result = ctclp::parser<opts>::try_parse<argc, argv>();
+  static_assert(parser_result, "test_positional_arguments: parsing failed."); 
+  static_assert(*parser_result.template get<"mode", std::string_view>().first == "test", 
+                "test_positional_arguments: mode does not match.");
+  static constexpr auto files = parser_result.template get_all<"files", std::string_view>();
+  static_assert(std::ranges::equal(*files.first, std::array<std::string_view, 2>{"a.cpp", "--b.cpp"}), 
+                "test_positional_arguments: files do not match.");
+}
+
+consteval auto test_help() noexcept {
+  static constexpr auto opts = ctclp::options<3>{}
+    .add<"unit", ctclp::option::string, ctclp::values<"celsius", "kelvin">, ctclp::default_value<"celsius">, 
+                 ctclp::short_name<'u'>>()
+    .add<"ratio", ctclp::option::floating_point, ctclp::range<0.0, 2.5>, ctclp::env<"RATIO">>()
+    .add<"files", ctclp::option::string, ctclp::any_string, ctclp::positional, ctclp::repeat<4>>();
+  using help = ctclp::help<"tool", opts>;
+  static_assert(help::usage == "Usage: tool [options] <files>...\n"
+                               "\n"
+                               "Options:\n"
+                               "  -u, --unit=<value>  values: celsius|kelvin; default: celsius\n"
+                               "  --ratio=<value>     range: 0..2.5; env: RATIO\n"
+                               "  --files=<value>     repeat: 4\n", 
+                "test_help: usage does not match.");
+  static_assert(help::values<"unit"> == "celsius kelvin", "test_help: values do not match.");
+  static_assert(help::values<"ratio">.empty(), "test_help: ranges should not list values.");
+  static_assert(help::zsh_completion == "#compdef tool\n"
+                                        "_arguments -s \\\n"
+                                        "  '--unit=[unit]:unit:(celsius kelvin)' \\\n"
+                                        "  '-u+[unit]:unit:(celsius kelvin)' \\\n"
+                                        "  '--ratio=[ratio]:ratio:' \\\n"
+                                        "  '*--files=[files]:files:'\n", 
+                "test_help: zsh completion does not match.");
+  static_assert(help::bash_completion.ends_with("complete -o nospace -F _tool tool\n"), 
+                "test_help: bash completion does not match.");
+}
+
 static constexpr auto opts = ctclp::options<3>{}
   .add<"count", ctclp::option::integral, ctclp::values<"1", "10", "100">, ctclp::default_value<"10">>()
   .add<"unit", ctclp::option::string, ctclp::values<"celsius", "fahrenheit", "kelvin">, ctclp::default_value<"celsius">>()
@@ -160,7 +603,7 @@ auto main() -> int {
     // char const* argv[]{"programm"};
     char const* argv[]{"programm", "--count=100", "--unit=kelvin", "--threshold=1.0"};
     // char const* argv[]{"programm", "--count=200"};
-    auto parser_result = ctclp::parser<opts, 256>::try_parse(argv);
+    auto parser_result = ctclp::parser<opts>::try_parse(argv);
 
     if (!parser_result) {
         std::cerr << "Parsing error:\n" << parser_result.errors << std::endl;
@@ -175,6 +618,84 @@ auto main() -> int {
     std::cout << "Count: " << *count.first << "\n";
     std::cout << "Unit: " << *unit.first << "\n";
     std::cout << "Threshold: " << *threshold.first << "\n";
+
+    std::array<std::string_view, 2> const valid_record{"--count=1", "--unit=fahrenheit"};
+    std::array<std::string_view, 1> const invalid_record{"--count=2"};
+    std::vector<std::span<std::string_view const>> records(64, valid_record);
+    records[17] = invalid_record;
+    std::vector<ctclp::parser<opts>::parser_result_t> results{};
+    if (ctclp::batch_parser<opts>::try_parse(records, results, 4) != records.size() - 1 || results[17]) {
+        std::cerr << "Batch parsing: unexpected results\n";
+        return 1;
+    }
+
+    ctclp::snapshots<opts> config{static_cast<int>(std::size(argv)), argv};
+    auto const before_reload = config.load();
+    char const* invalid_argv[]{"programm", "--count=200"};
+    char const* reload_argv[]{"programm", "--count=1"};
+    if (*config.reload(2, invalid_argv) || *config.load()->get<"count", int>().first != 100 || 
+        !*config.reload(2, reload_argv) || *config.load()->get<"count", int>().first != 1 || 
+        *before_reload->get<"count", int>().first != 100) {
+        std::cerr << "Snapshots: unexpected results\n";
+        return 1;
+    }
+
+#if __has_include(<sys/mman.h>)
+    static constexpr auto sourced_opts = ctclp::options<4>{}
+      .add<"port", ctclp::option::integral, ctclp::range<1, 65535>, 
+                   ctclp::env<"CTCLP_TEST_PORT">, ctclp::default_value<"8080">>()
+      .add<"unit", ctclp::option::string, ctclp::values<"celsius", "fahrenheit", "kelvin">, 
+                   ctclp::env<"CTCLP_TEST_UNIT">, ctclp::default_value<"celsius">>()
+      .add<"count", ctclp::option::integral, ctclp::values<"1", "10", "100">, 
+                    ctclp::env<"CTCLP_TEST_COUNT">, ctclp::default_value<"10">>()
+      .add<"level", ctclp::option::integral, ctclp::range<0, 9>, ctclp::default_value<"0">>();
+    auto const response_path = std::filesystem::temp_directory_path() / "ctclp_tests_response_file";
+    std::ofstream{response_path} << "--port=2000\n  --unit=fahrenheit\n";
+    ::setenv("CTCLP_TEST_PORT", "1000", 1);
+    ::setenv("CTCLP_TEST_UNIT", "kelvin", 1);
+    ::setenv("CTCLP_TEST_COUNT", "100", 1);
+    auto const response_argument = "@" + response_path.string();
+    char const* sourced_argv[]{"programm", response_argument.c_str(), "--port=3000"};
+    ctclp::response_files files{};
+    auto const sourced_result = ctclp::parser<sourced_opts>::try_parse(3, sourced_argv, files);
+    if (!sourced_result || *sourced_result.get<"port", int>().first != 3000 || 
+        *sourced_result.get<"unit", std::string_view>().first != "fahrenheit" || 
+        *sourced_result.get<"count", int>().first != 100 || *sourced_result.get<"level", int>().first != 0) {
+        std::cerr << "Response files and environment: precedence does not match\n";
+        return 1;
+    }
+
+    ::setenv("CTCLP_TEST_COUNT", "7", 1);
+    char const* missing_argv[]{"programm", "@/nonexistent/ctclp_tests_response_file"};
+    ctclp::response_files missing_files{};
+    auto const missing_result = ctclp::parser<sourced_opts, ctclp::error_policy{.capacity = 4}>::try_parse(
+      2, missing_argv, missing_files);
+    if (missing_result.errors.count() != 2 || 
+        missing_result.errors.data[0].code != ctclp::error_code::response_file_error || 
+        missing_result.errors.data[1].code != ctclp::error_code::parse_error || 
+        missing_result.errors.data[1].argument != ctclp::parse_error_info::environment || 
+        missing_result.errors.option_name(missing_result.errors.data[1]) != "count") {
+        std::cerr << "Response files and environment: errors do not match\n";
+        return 1;
+    }
+    ::unsetenv("CTCLP_TEST_PORT");
+    ::unsetenv("CTCLP_TEST_UNIT");
+    ::unsetenv("CTCLP_TEST_COUNT");
+    std::filesystem::remove(response_path);
+#endif
+
+    using counted_parser = ctclp::parser<opts, ctclp::error_policy{}, ctclp::stats_policy{.enabled = true}>;
+    auto const counted_result = counted_parser::try_parse(argv);
+    char const* failing_argv[]{"programm", "--count=2"};
+    auto const failed_result = counted_parser::try_parse(failing_argv);
+    (void)counted_result.get<"count", int>();
+    (void)counted_result.get<"count", int>();
+    auto const stats = counted_parser::stats();
+    if (failed_result || stats.parses != 2 || stats.failed_parses != 1 || stats.gets[0] != 2 || 
+        stats.errors[static_cast<size_t>(failed_result.errors.begin()->code)] != 1) {
+        std::cerr << "Stats: unexpected results\n";
+        return 1;
+    }
  
   return 0;
 }